@@ -0,0 +1,404 @@
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cplex_environment_pool.hpp>
+#include <instance_generator.hpp>
+#include <log_sink.hpp>
+#include <matrix.hpp>
+#include <ops_cp_solver.hpp>
+#include <ops_cplex_solver.hpp>
+#include <ops_input.hpp>
+#include <ops_output.hpp>
+#include <solver_config.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// The data classes checked in the repository.
+const std::vector<std::string> kModelClasses {"A", "B", "C", "LA", "LB", "LC"};
+
+// Amount of objects and sliding bars of the synthetic instances.
+constexpr std::pair<int, int> kSyntheticSizes[] {
+  {20, 1}, {20, 3}, {200, 3}, {200, 10}, {2000, 10}, {2000, 55}
+};
+
+// Tolerance used by the solver, the same as the tests.
+constexpr double kTolerance = 1e-4;
+
+// Seconds each formulation is given to solve an instance of the data classes.
+constexpr double kSolveTimeLimit = 60.0;
+
+/** @brief Reads the whole content of a file. */
+std::string readFile(const std::string &file_name) {
+  std::ifstream file(file_name);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+/**
+ * @brief Creates an output with a trivial feasible solution, where every
+ * sliding bar goes straight from the first to the last node.
+ *
+ * @param input The input of the O.P.S. problem.
+ * @return The output with the trivial solution.
+ */
+emir::OpsOutput makeTrivialOutput(const emir::OpsInput &input) {
+  std::size_t amount_of_arcs = 0;
+  for (std::size_t k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    amount_of_arcs += input.getGraph((int)k).getArcs().size();
+  }
+  std::vector<double> used_arcs(amount_of_arcs, 0);
+  for (std::size_t k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    used_arcs[input.getGraph((int)k).getArcs().front().getId()] = 1;
+  }
+  emir::OpsOutput output(input);
+  output.setUsedArcs(used_arcs);
+  output.setObservedObjects(
+    std::vector<double>(input.getAmountOfObjects() - 2, 0)
+  );
+  output.setTimeAtObjects(std::vector<double>(input.getAmountOfObjects(), 0));
+  output.setTimeSpent(0);
+  return output;
+}
+
+// ------------------------------ Benchmarks ------------------------------- //
+
+/** @brief Parses the JSON instance without building the graphs. */
+void parseInstance(benchmark::State &state, const std::string &content) {
+  for (auto _ : state) {
+    std::istringstream input_stream(content);
+    emir::OpsInstance instance;
+    input_stream >> instance;
+    benchmark::DoNotOptimize(instance);
+  }
+  state.SetBytesProcessed(
+    (std::int64_t)state.iterations() * (std::int64_t)content.size()
+  );
+}
+
+/** @brief Builds the graph of every sliding bar of an instance. */
+void createGraphs(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInstance parsed_instance;
+  input_stream >> parsed_instance;
+  for (auto _ : state) {
+    emir::OpsInput input(parsed_instance);
+    benchmark::DoNotOptimize(input);
+  }
+  state.counters["objects"] = (double)parsed_instance.getAmountOfObjects();
+  state.counters["sliding_bars"] =
+    (double)parsed_instance.getAmountOfSlidingBars();
+}
+
+/** @brief Gets the successors and predecessors of every node of each graph. */
+void searchArcs(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  for (auto _ : state) {
+    for (std::size_t k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+      const auto &graph = input.getGraph((int)k);
+      for (const auto &node_id : graph.getNodesId()) {
+        benchmark::DoNotOptimize(graph.getSuccessorsArcsId(node_id));
+        benchmark::DoNotOptimize(graph.getPredecessorsArcsId(node_id));
+      }
+    }
+  }
+}
+
+/** @brief Makes and extracts the CPLEX model (without solving it). */
+void makeModel(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  for (auto _ : state) {
+    emir::OpsCplexSolver solver(input, kTolerance);
+    benchmark::DoNotOptimize(solver);
+  }
+}
+
+/**
+ * @brief Makes and extracts the CPLEX model in an environment lent by a pool,
+ * to compare against creating and ending one environment for each instance.
+ */
+void makeModelPooled(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  emir::CplexEnvironmentPool environments;
+  for (auto _ : state) {
+    const auto lease = environments.acquire();
+    emir::OpsCplexSolver solver(
+      emir::OpsInput(input), {.tolerance = kTolerance},
+      lease.getEnvironment()
+    );
+    benchmark::DoNotOptimize(solver);
+  }
+}
+
+/**
+ * @brief Solves the instance with a formulation (up to kSolveTimeLimit),
+ * reporting the bound of its linear relaxation and the size of the model, to
+ * choose the formulation of each class.
+ */
+void solveFormulation(
+  benchmark::State &state, const std::string &content,
+  const emir::Formulation formulation
+) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  DiscardLogSink log_sink;
+  for (auto _ : state) {
+    // Only the solve is timed, the model is measured by makeModel
+    state.PauseTiming();
+    emir::OpsCplexSolver solver(
+      emir::OpsInput(input),
+      {.tolerance = kTolerance,
+       .time_limit = kSolveTimeLimit,
+       .formulation = formulation}
+    );
+    solver.addLog(log_sink.getStream());
+    state.counters["bound"] = solver.getRelaxationBound();
+    state.counters["rows"] = (double)solver.getAmountOfRows();
+    state.counters["columns"] = (double)solver.getAmountOfColumns();
+    state.ResumeTiming();
+    solver.solve();
+    state.counters["profit"] = (double)solver.getOutput().getTotalProfit();
+  }
+}
+
+/**
+ * @brief Solves the instance with a branching strategy (up to
+ * kSolveTimeLimit), reporting the nodes explored to compare the strategies.
+ */
+void solveBranching(
+  benchmark::State &state, const std::string &content,
+  const emir::Branching branching
+) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  DiscardLogSink log_sink;
+  for (auto _ : state) {
+    emir::OpsCplexSolver solver(
+      emir::OpsInput(input),
+      {.tolerance = kTolerance,
+       .time_limit = kSolveTimeLimit,
+       .branching = branching}
+    );
+    solver.addLog(log_sink.getStream());
+    solver.solve();
+    state.counters["nodes"] = (double)solver.getOutput().getNodes();
+    state.counters["profit"] = (double)solver.getOutput().getTotalProfit();
+  }
+}
+
+/**
+ * @brief Solves the instance with CP Optimizer (up to kSolveTimeLimit), to
+ * compare it against the formulations of CPLEX.
+ */
+void solveCp(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  DiscardLogSink log_sink;
+  for (auto _ : state) {
+    emir::OpsCpSolver solver(
+      emir::OpsInput(input),
+      {.tolerance = kTolerance, .time_limit = kSolveTimeLimit}
+    );
+    solver.addLog(log_sink.getStream());
+    solver.solve();
+    state.counters["profit"] = (double)solver.getOutput().getTotalProfit();
+  }
+}
+
+/** @brief Checks the constraints of a solution. */
+void checkOutput(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  const auto output = makeTrivialOutput(input);
+  for (auto _ : state) { output.check(); }
+}
+
+/** @brief Serializes a solution to JSON. */
+void serializeOutput(benchmark::State &state, const std::string &content) {
+  std::istringstream input_stream(content);
+  emir::OpsInput input;
+  input_stream >> input;
+  const auto output = makeTrivialOutput(input);
+  for (auto _ : state) {
+    std::ostringstream output_stream;
+    output_stream << output;
+    benchmark::DoNotOptimize(output_stream.str());
+  }
+}
+
+/** @brief Reads a matrix going through each row. */
+void BM_MatrixRowAccess(benchmark::State &state) {
+  const auto size = (std::size_t)state.range(0);
+  Matrix<int> matrix({size, size});
+  matrix.init(1);
+  for (auto _ : state) {
+    long sum = 0;
+    for (std::size_t row = 0; row < size; ++row) {
+      for (std::size_t col = 0; col < size; ++col) {
+        sum += matrix({row, col});
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed((std::int64_t)(state.iterations() * size * size));
+}
+
+/** @brief Reads a matrix going through each column. */
+void BM_MatrixColumnAccess(benchmark::State &state) {
+  const auto size = (std::size_t)state.range(0);
+  Matrix<int> matrix({size, size});
+  matrix.init(1);
+  for (auto _ : state) {
+    long sum = 0;
+    for (std::size_t col = 0; col < size; ++col) {
+      for (std::size_t row = 0; row < size; ++row) {
+        sum += matrix({row, col});
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed((std::int64_t)(state.iterations() * size * size));
+}
+
+/** @brief Reads a matrix taking a reference to each row first. */
+void BM_MatrixRowReferenceAccess(benchmark::State &state) {
+  const auto size = (std::size_t)state.range(0);
+  Matrix<int> matrix({size, size});
+  matrix.init(1);
+  for (auto _ : state) {
+    long sum = 0;
+    for (std::size_t row = 0; row < size; ++row) {
+      for (const auto value : matrix[row]) { sum += value; }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed((std::int64_t)(state.iterations() * size * size));
+}
+
+/**
+ * @brief Registers every stage of the pipeline for the given instance.
+ *
+ * @param name The name used to identify the instance in the results.
+ * @param content The content of the instance file.
+ */
+void registerPipeline(const std::string &name, const std::string &content) {
+  benchmark::RegisterBenchmark(
+    std::format("parseInstance/{}", name), parseInstance, content
+  );
+  benchmark::RegisterBenchmark(
+    std::format("createGraphs/{}", name), createGraphs, content
+  );
+  benchmark::RegisterBenchmark(
+    std::format("searchArcs/{}", name), searchArcs, content
+  );
+  benchmark::RegisterBenchmark(
+    std::format("makeModel/{}", name), makeModel, content
+  )
+    ->Unit(benchmark::kMillisecond);
+  benchmark::RegisterBenchmark(
+    std::format("makeModelPooled/{}", name), makeModelPooled, content
+  )
+    ->Unit(benchmark::kMillisecond);
+  benchmark::RegisterBenchmark(
+    std::format("checkOutput/{}", name), checkOutput, content
+  );
+  benchmark::RegisterBenchmark(
+    std::format("serializeOutput/{}", name), serializeOutput, content
+  );
+}
+
+/** @brief Registers the pipeline for each instance of the data classes. */
+void registerDataClasses() {
+  for (const auto &model_class : kModelClasses) {
+    const auto input_folder = std::format("data/{}/instances", model_class);
+    if (!fs::exists(input_folder)) { continue; }
+    for (const auto &entry : fs::directory_iterator(input_folder)) {
+      const auto name =
+        std::format("{}/{}", model_class, entry.path().stem().string());
+      const auto content = readFile(entry.path());
+      registerPipeline(name, content);
+      // Solving is too slow for the synthetic instances
+      for (const auto formulation :
+           {emir::Formulation::kMtz, emir::Formulation::kTimeFlow,
+            emir::Formulation::kTimeIndexed}) {
+        benchmark::RegisterBenchmark(
+          std::format("solve/{}/{}", emir::toString(formulation), name),
+          solveFormulation, content, formulation
+        )
+          ->Unit(benchmark::kMillisecond)
+          ->Iterations(1);
+      }
+      benchmark::RegisterBenchmark(
+        std::format("solve/cp/{}", name), solveCp, content
+      )
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(1);
+      for (const auto branching :
+           {emir::Branching::kCplex, emir::Branching::kPriorities,
+            emir::Branching::kAggregates}) {
+        benchmark::RegisterBenchmark(
+          std::format("branch/{}/{}", emir::toString(branching), name),
+          solveBranching, content, branching
+        )
+          ->Unit(benchmark::kMillisecond)
+          ->Iterations(1);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Registers the pipeline for synthetic instances of growing size, up to
+ * 100 times the amount of objects of the data classes.
+ */
+void registerSyntheticInstances() {
+  for (const auto [amount_of_objects, amount_of_sliding_bars] :
+       kSyntheticSizes) {
+    emir::InstanceGenerator generator({
+      .amount_of_objects = amount_of_objects,
+      .amount_of_sliding_bars = amount_of_sliding_bars,
+      .bar_overlap = 0.2,
+    });
+    registerPipeline(
+      std::format(
+        "synthetic/n:{}/K:{}", amount_of_objects, amount_of_sliding_bars
+      ),
+      generator.generate().dump()
+    );
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_MatrixRowAccess)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_MatrixColumnAccess)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_MatrixRowReferenceAccess)->RangeMultiplier(4)->Range(16, 1024);
+
+int main(int argc, char *argv[]) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+  registerDataClasses();
+  registerSyntheticInstances();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file instance_generator.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a generator of synthetic
+ * instances for the O.P.S. problem, written in the same JSON schema as the
+ * data classes.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Selective routing problem with synchronization: @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope: @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_INSTANCE_GENERATOR_HPP_
+#define EMIR_INSTANCE_GENERATOR_HPP_
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace emir {
+
+/** @brief How the priorities of the objects are distributed. */
+enum class PriorityDistribution {
+  // Every priority between 1 and the maximum is equally likely.
+  kUniform,
+  // Most objects have a low priority and only a few a high one.
+  kSkewed,
+  // Every object has the maximum priority.
+  kConstant,
+};
+
+/** @brief Parameters used to generate a synthetic instance. */
+struct GeneratorConfig {
+  // Amount of objects to observe (without the initial and final nodes).
+  int amount_of_objects {50};
+  // Amount of sliding bars.
+  int amount_of_sliding_bars {3};
+  // Probability that an object also needs the next sliding bar.
+  double bar_overlap {0.0};
+  // Fraction of the time needed by the busiest sliding bar to observe all of
+  // its objects that is given as time limit.
+  double time_limit_tightness {0.5};
+  // How the priorities of the objects are distributed.
+  PriorityDistribution priority_distribution {PriorityDistribution::kUniform};
+  // Maximum priority an object can have.
+  int max_priority {10};
+  // Whether the travel times satisfy the triangle inequality.
+  bool metric {true};
+  // Seed used by the random number generator.
+  unsigned int seed {0};
+  // Name of the instance.
+  std::string name {"synthetic"};
+};
+
+/**
+ * @brief Generates instances for the O.P.S. problem. The objects are placed
+ * in the field of view of the telescope and each one has an exposure time,
+ * so the time to process an object and go to another one is the exposure of
+ * the first plus the travel between both.
+ */
+class InstanceGenerator {
+ public:
+  /**
+   * @brief Creates a generator with the given parameters.
+   *
+   * @param config The parameters of the instances to generate.
+   */
+  explicit InstanceGenerator(GeneratorConfig config);
+
+  /**
+   * @brief Generates an instance. Two generators with the same parameters
+   * (and seed) generate the same instance.
+   *
+   * @return The instance in the JSON schema of the data classes.
+   */
+  [[nodiscard]] nlohmann::json generate();
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The factor used to store the times as integers, the same as OpsInstance.
+  static constexpr int kScalingFactor = 10;
+  // Minimum and maximum exposure time of an object (in seconds).
+  static constexpr std::pair<double, double> kExposureRange {30.0, 300.0};
+  // Maximum travel time between two objects (in seconds).
+  static constexpr double kMaxTravelTime = 60.0;
+  // Type code of the synthetic instances.
+  static constexpr int kInstanceType = 0;
+  // Date stamp of the synthetic instances (the epoch, in the "%c" format of
+  // the C locale), so the same parameters always give the same file.
+  static constexpr const char *kDateStamp = "Thu Jan  1 00:00:00 1970";
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The parameters of the instances to generate.
+  GeneratorConfig config_;
+  // The random number generator.
+  std::mt19937 random_generator_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Generates the time to process each object and go to another one.
+   * The first and last nodes are placed in the center of the field of view
+   * and have no exposure time.
+   */
+  [[nodiscard]] std::vector<std::vector<int>> generateTimes();
+
+  /** @brief Generates the priority of each object, zero for the endpoints. */
+  [[nodiscard]] std::vector<int> generatePriorities();
+
+  /**
+   * @brief Assigns each object to a sliding bar, extending it to the next
+   * ones with the probability given by the overlap.
+   */
+  [[nodiscard]] std::vector<std::vector<unsigned int>>
+  generateObjectsPerSlidingBar();
+
+  /**
+   * @brief Calculates the time limit from the time needed to observe all the
+   * objects of the busiest sliding bar.
+   *
+   * @param times The time to process each object and go to another one.
+   * @param objects_per_sliding_bar The objects of each sliding bar.
+   */
+  [[nodiscard]] int calculateTimeLimit(
+    const std::vector<std::vector<int>> &times,
+    const std::vector<std::vector<unsigned int>> &objects_per_sliding_bar
+  ) const;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_INSTANCE_GENERATOR_HPP_
\ No newline at end of file
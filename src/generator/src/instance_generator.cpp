@@ -0,0 +1,194 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file instance_generator.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the generator of synthetic
+ * instances for the O.P.S. problem.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Selective routing problem with synchronization: @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope: @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <instance_generator.hpp>
+#include <ops_error.hpp>
+
+namespace emir {
+
+InstanceGenerator::InstanceGenerator(GeneratorConfig config) :
+  config_ {std::move(config)}, random_generator_ {config_.seed} {
+  if (config_.amount_of_objects < 1 || config_.amount_of_sliding_bars < 1) {
+    throw OpsError(
+      "At least one object and one sliding bar are needed. Got {} objects and "
+      "{} sliding bars.",
+      config_.amount_of_objects, config_.amount_of_sliding_bars
+    );
+  }
+  if (config_.bar_overlap < 0 || config_.bar_overlap >= 1) {
+    throw OpsError(
+      "The bar overlap must be in [0, 1). Got {}.", config_.bar_overlap
+    );
+  }
+  if (config_.time_limit_tightness <= 0) {
+    throw OpsError(
+      "The time limit tightness must be positive. Got {}.",
+      config_.time_limit_tightness
+    );
+  }
+}
+
+nlohmann::json InstanceGenerator::generate() {
+  random_generator_.seed(config_.seed);
+  const auto times = generateTimes();
+  const auto priorities = generatePriorities();
+  const auto objects_per_sliding_bar = generateObjectsPerSlidingBar();
+  return {
+    {"T", times},
+    {"b", priorities},
+    {"Jk", objects_per_sliding_bar},
+    {"L", calculateTimeLimit(times, objects_per_sliding_bar)},
+    {"alpha", config_.time_limit_tightness},
+    {"id",
+     {std::format(
+        "{}-n{}-K{}-s{}", config_.name, config_.amount_of_objects,
+        config_.amount_of_sliding_bars, config_.seed
+      ),
+      InstanceGenerator::kDateStamp}},
+    {"type", InstanceGenerator::kInstanceType}
+  };
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+std::vector<std::vector<int>> InstanceGenerator::generateTimes() {
+  const auto size = (std::size_t)config_.amount_of_objects + 2;
+  std::uniform_real_distribution<double> position_distribution(0.0, 1.0);
+  std::uniform_real_distribution<double> exposure_distribution(
+    InstanceGenerator::kExposureRange.first,
+    InstanceGenerator::kExposureRange.second
+  );
+  std::uniform_real_distribution<double> travel_distribution(
+    0.0, InstanceGenerator::kMaxTravelTime
+  );
+
+  std::vector<std::pair<double, double>> positions(size, {0.5, 0.5});
+  std::vector<double> exposures(size, 0.0);
+  for (std::size_t object = 1; object < size - 1; ++object) {
+    positions[object] = {
+      position_distribution(random_generator_),
+      position_distribution(random_generator_)
+    };
+    exposures[object] = exposure_distribution(random_generator_);
+  }
+
+  std::vector<std::vector<int>> times(size, std::vector<int>(size, 0));
+  for (std::size_t origin = 0; origin < size; ++origin) {
+    for (std::size_t destination = 0; destination < size; ++destination) {
+      if (origin == destination) { continue; }
+      const auto [origin_x, origin_y] = positions[origin];
+      const auto [destination_x, destination_y] = positions[destination];
+      const double travel =
+        config_.metric ? InstanceGenerator::kMaxTravelTime *
+                           std::hypot(
+                             origin_x - destination_x, origin_y - destination_y
+                           ) /
+                           std::sqrt(2.0)
+                       : travel_distribution(random_generator_);
+      // Rounding up the exposure and the travel separately keeps the triangle
+      // inequality of the metric case after scaling to integers.
+      times[origin][destination] =
+        (int)std::ceil(exposures[origin] * InstanceGenerator::kScalingFactor) +
+        (int)std::ceil(travel * InstanceGenerator::kScalingFactor);
+    }
+  }
+  return times;
+}
+
+std::vector<int> InstanceGenerator::generatePriorities() {
+  std::vector<int> priorities(config_.amount_of_objects + 2, 0);
+  std::uniform_int_distribution<int> uniform_distribution(
+    1, config_.max_priority
+  );
+  std::geometric_distribution<int> skewed_distribution(0.5);
+  for (std::size_t object = 1; object < priorities.size() - 1; ++object) {
+    switch (config_.priority_distribution) {
+      case PriorityDistribution::kUniform:
+        priorities[object] = uniform_distribution(random_generator_);
+        break;
+      case PriorityDistribution::kSkewed:
+        priorities[object] = std::min(
+          1 + skewed_distribution(random_generator_), config_.max_priority
+        );
+        break;
+      case PriorityDistribution::kConstant:
+        priorities[object] = config_.max_priority;
+        break;
+    }
+  }
+  return priorities;
+}
+
+std::vector<std::vector<unsigned int>>
+InstanceGenerator::generateObjectsPerSlidingBar() {
+  const auto amount_of_sliding_bars = config_.amount_of_sliding_bars;
+  std::vector<std::vector<unsigned int>> objects_per_sliding_bar(
+    amount_of_sliding_bars
+  );
+  std::uniform_int_distribution<int> bar_distribution(
+    0, amount_of_sliding_bars - 1
+  );
+  std::bernoulli_distribution overlap_distribution(config_.bar_overlap);
+  for (int object = 1; object <= config_.amount_of_objects; ++object) {
+    auto sliding_bar = bar_distribution(random_generator_);
+    objects_per_sliding_bar[sliding_bar].push_back(object);
+    while (sliding_bar + 1 < amount_of_sliding_bars &&
+           overlap_distribution(random_generator_)) {
+      objects_per_sliding_bar[++sliding_bar].push_back(object);
+    }
+  }
+  return objects_per_sliding_bar;
+}
+
+int InstanceGenerator::calculateTimeLimit(
+  const std::vector<std::vector<int>> &times,
+  const std::vector<std::vector<unsigned int>> &objects_per_sliding_bar
+) const {
+  long busiest_bar_time = 0;
+  for (const auto &objects : objects_per_sliding_bar) {
+    // Approximate the time of the bar with the mean time to reach each object
+    long bar_time = 0;
+    for (const auto &object : objects) {
+      long time_to_object = 0;
+      for (const auto &row : times) { time_to_object += row[object]; }
+      bar_time += time_to_object / (long)(times.size() - 1);
+    }
+    busiest_bar_time = std::max(busiest_bar_time, bar_time);
+  }
+  return std::max(
+    1, (int)std::lround(config_.time_limit_tightness * (double)busiest_bar_time)
+  );
+}
+
+}  // namespace emir
\ No newline at end of file
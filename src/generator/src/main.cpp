@@ -0,0 +1,181 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file main.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the main function of the tool that writes synthetic
+ * instances for scaling studies.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Selective routing problem with synchronization: @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope: @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <input_parser/parser.hpp>
+#include <input_parser/parsing_error.hpp>
+
+#include <instance_generator.hpp>
+#include <ops_error.hpp>
+
+/**
+ * @brief Creates a parser for the parameters of the generator.
+ *
+ * @return The parser created.
+ */
+input_parser::Parser createParser() {
+  return input_parser::Parser()
+    .addHelpOption()
+    .addOption([] {
+      return input_parser::SingleOption("-o", "--output")
+        .addDescription("Path of the instance file to be written")
+        .addDefaultValue(std::string("instance.json"));
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-n", "--objects")
+        .addDescription("Amount of objects to observe")
+        .addDefaultValue(std::string("50"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The amount of objects must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-k", "--sliding-bars")
+        .addDescription("Amount of sliding bars")
+        .addDefaultValue(std::string("3"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The amount of sliding bars must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-v", "--overlap")
+        .addDescription("Probability that an object also needs the next bar")
+        .addDefaultValue(std::string("0"))
+        .toDouble()
+        .transformBeforeCheck()
+        .addConstraint<double>(
+          [](const auto &value) -> bool { return value >= 0 && value < 1; },
+          "The overlap must be in [0, 1)"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-a", "--tightness")
+        .addDescription("Fraction of the busiest bar time given as time limit")
+        .addDefaultValue(std::string("0.5"))
+        .toDouble()
+        .transformBeforeCheck()
+        .addConstraint<double>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The tightness must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-p", "--priorities")
+        .addDescription("Distribution of the priorities")
+        .addDefaultValue(std::string("uniform"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "uniform" || value == "skewed" ||
+                   value == "constant";
+          },
+          "The distribution must be one of the following: uniform, skewed, "
+          "constant"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-m", "--travel-times")
+        .addDescription("Whether the travel times are metric or not")
+        .addDefaultValue(std::string("metric"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "metric" || value == "non-metric";
+          },
+          "The travel times must be one of the following: metric, non-metric"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-s", "--seed")
+        .addDescription("Seed of the random number generator")
+        .addDefaultValue(std::string("0"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The seed must be non-negative"
+        );
+    });
+}
+
+/**
+ * @brief Converts the name of a priority distribution to its value.
+ *
+ * @param name The name of the distribution.
+ */
+emir::PriorityDistribution toPriorityDistribution(const std::string &name) {
+  if (name == "skewed") { return emir::PriorityDistribution::kSkewed; }
+  if (name == "constant") { return emir::PriorityDistribution::kConstant; }
+  return emir::PriorityDistribution::kUniform;
+}
+
+/** @brief Writes a synthetic instance with the given parameters. */
+int secureMain(int argc, char *argv[]) {
+  auto parser = createParser();
+
+  try {
+    parser.parse(argc, argv);
+  } catch (const input_parser::ParsingError &e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
+
+  const auto &output_path = parser.getValue<std::string>("--output");
+  emir::InstanceGenerator generator({
+    .amount_of_objects = parser.getValue<int>("--objects"),
+    .amount_of_sliding_bars = parser.getValue<int>("--sliding-bars"),
+    .bar_overlap = parser.getValue<double>("--overlap"),
+    .time_limit_tightness = parser.getValue<double>("--tightness"),
+    .priority_distribution =
+      toPriorityDistribution(parser.getValue<std::string>("--priorities")),
+    .metric = parser.getValue<std::string>("--travel-times") == "metric",
+    .seed = (unsigned int)parser.getValue<int>("--seed"),
+    .name = std::filesystem::path(output_path).stem().string(),
+  });
+  std::ofstream output_os(output_path);
+  output_os << generator.generate().dump();
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  try {
+    return secureMain(argc, argv);
+  } catch (const emir::OpsError &e) {
+    std::cerr << "OspError: " << e.what() << '\n';
+    return 1;
+  } catch (const std::exception &e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return 1;
+  }
+}
\ No newline at end of file
@@ -35,18 +35,17 @@ namespace emir {
 /** @brief Represents an arc in the graph */
 class Arc {
  public:
-  /** @brief Resets the arc id counter */
-  static void resetIdCounter();
-
   /**
-   * @brief Creates a new arc (from_node -> to_node) with an unique id
+   * @brief Creates a new arc (from_node -> to_node)
    *
+   * @param id Identifier of the arc, unique among the arcs of an input
    * @param from Origin node of the arc
    * @param cost The cost of the arc
    * @param to Destination node of the arc
    */
   Arc(
-    std::shared_ptr<Node> origin, int cost, std::shared_ptr<Node> destination
+    unsigned int id, std::shared_ptr<Node> origin, int cost,
+    std::shared_ptr<Node> destination
   );
 
   // ------------------------------ Getters -------------------------------- //
@@ -68,9 +67,6 @@ class Arc {
   [[nodiscard]] unsigned int getDestinationId() const;
 
  private:
-  // Keeps track of the amount of arcs created
-  static unsigned int id_counter_;
-
   // ----------------------------- Attributes ------------------------------ //
 
   // Identifier of the arc
@@ -26,6 +26,7 @@
 #ifndef EMIR_GRAPH_HPP_
 #define EMIR_GRAPH_HPP_
 
+#include <optional>
 #include <ranges>
 
 #include <arc.hpp>
@@ -84,6 +85,24 @@ class Graph {
     return nodes_.at(node_id)->getPredecessorsArcsId();
   }
 
+  /**
+   * @brief Gets the id of the arc with the given endpoints.
+   *
+   * @param arc_endpoints Endpoints of the arc.
+   * @return The id of the arc, or nothing if the graph does not have it.
+   */
+  [[nodiscard]] std::optional<unsigned int>
+  getArcId(ArcEndpoints arc_endpoints) const;
+
+  // ------------------------------- Utility ------------------------------- //
+
+  /**
+   * @brief Creates a copy that shares no node with this graph. The copies
+   * made by the copy constructor share their nodes, so arcs must only be
+   * added to a graph created with this method.
+   */
+  [[nodiscard]] Graph clone() const;
+
   // ------------------------------- Adders ------------------------------- //
 
   /**
@@ -91,8 +110,9 @@ class Graph {
    *
    * @param arc_endpoints Endpoints of the arc.
    * @param cost Cost of the arc
+   * @param arc_id Identifier of the arc
    */
-  void addArc(ArcEndpoints end_points, int cost);
+  void addArc(ArcEndpoints end_points, int cost, unsigned int arc_id);
 
  private:
   // ----------------------------- Attributes ------------------------------ //
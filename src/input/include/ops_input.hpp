@@ -26,11 +26,27 @@
 #ifndef EMIR_OPS_INPUT_HPP_
 #define EMIR_OPS_INPUT_HPP_
 
+#include <cstddef>
+#include <vector>
+
 #include <graph.hpp>
 #include <ops_instance.hpp>
 
 namespace emir {
 
+/**
+ * @brief Two sliding bars where one of them can observe every object of the
+ * other one.
+ */
+struct NestedSlidingBars {
+  // The sliding bar whose objects can all be observed by the other one
+  int inner_idx;
+  // The sliding bar that can observe every object of the inner one
+  int outer_idx;
+  // Whether both sliding bars can observe the same objects
+  bool are_equal;
+};
+
 /**
  * @brief Represents a OPS instance with the data structures needed to represent
  * the math model and the graphs.
@@ -40,14 +56,21 @@ class OpsInput : public OpsInstance {
   /** @brief Construct an empty input instance. */
   OpsInput() = default;
 
+  /**
+   * @brief Builds the graphs of an instance that has already been read.
+   *
+   * @param instance The instance with the data of the math model.
+   */
+  explicit OpsInput(const OpsInstance &instance);
+
   /** @brief Copies the input instance */
   OpsInput(const OpsInput &) = default;
 
   /** @brief Moves the input instance */
   OpsInput(OpsInput &&) = default;
 
-  /** @brief Resets the arc id counter. */
-  ~OpsInput();
+  /** @brief Default destructor. */
+  ~OpsInput() = default;
 
   // ------------------------------ Getters -------------------------------- //
 
@@ -64,6 +87,44 @@ class OpsInput : public OpsInstance {
   /** @brief Gets the maximum cost of any arc in the graph */
   [[nodiscard]] unsigned int getMaxArc() const;
 
+  /** @brief Gets the amount of arcs of every graph */
+  [[nodiscard]] std::size_t getAmountOfArcs() const;
+
+  /**
+   * @brief Gets the sliding bars whose objects can all be observed by another
+   * sliding bar. Every sliding bar with the same objects as a previous one is
+   * paired with the first of them, and the rest with the smallest sliding bar
+   * that contains them (if any). Only the inner sliding bars whose objects
+   * take some time to go from one to another are given, since otherwise the
+   * order of their objects is not decided by the times.
+   */
+  [[nodiscard]] std::vector<NestedSlidingBars> getNestedSlidingBars() const;
+
+  // ------------------------------ Modifiers ------------------------------ //
+
+  /**
+   * @brief Lets the k-th sliding bar observe an object, adding the arcs that
+   * connect it with the objects of the sliding bar and the first and last
+   * nodes. The arcs the graph already has (from a previous time the object
+   * was in the sliding bar) are not created again.
+   *
+   * @param graph_idx The index of the sliding bar
+   * @param object_id The object to add, between 1 and the amount of objects
+   * minus 2
+   * @return The ids of the arcs created, following the last id of the input
+   */
+  std::vector<unsigned int>
+  addObjectToSlidingBar(int graph_idx, unsigned int object_id);
+
+  /**
+   * @brief Stops the k-th sliding bar from observing an object. The arcs of
+   * the object are kept in the graph, so their ids stay valid.
+   *
+   * @param graph_idx The index of the sliding bar
+   * @param object_id The object to remove
+   */
+  void removeObjectFromSlidingBar(int graph_idx, unsigned int object_id);
+
   // ------------------------------ Operators ------------------------------ //
 
   /**
@@ -110,8 +171,21 @@ class OpsInput : public OpsInstance {
    * - The first node goes to all the nodes in the sliding bar.
    * - All the nodes in the sliding bar go to the last node.
    * - Each node goes to all the other nodes in the sliding bar.
+   * The ids of the arcs are consecutive across every graph of the input, so
+   * they can be used as indexes of the arc variables of the model.
+   *
+   * @param graph_idx The index of the sliding bar
+   * @param next_arc_id The id of the next arc, updated with each arc created
+   */
+  void addGraphArcs(int graph_idx, unsigned int &next_arc_id);
+
+  /**
+   * @brief Checks that going from any object to another takes some time
+   *
+   * @param objects The objects to check
    */
-  void addGraphArcs(int graph_idx);
+  [[nodiscard]] bool hasPositiveTimes(const std::vector<unsigned int> &objects
+  ) const;
 };
 
 }  // namespace emir
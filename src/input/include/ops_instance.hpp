@@ -25,7 +25,10 @@
 #ifndef EMIR_OPS_INSTANCE_HPP_
 #define EMIR_OPS_INSTANCE_HPP_
 
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -44,6 +47,17 @@ class OpsInstance {
    */
   explicit OpsInstance(double scaling_factor = 10);
 
+  /**
+   * @brief Construct a new Ops Instance object from an instance already
+   * parsed as JSON.
+   *
+   * @param json_instance The json with the ops information
+   * @param scaling_factor The scaling factor to use
+   */
+  explicit OpsInstance(
+    const nlohmann::json &json_instance, double scaling_factor = 10
+  );
+
   // ------------------------------ Getters -------------------------------- //
 
   /**
@@ -101,6 +115,37 @@ class OpsInstance {
     return scaling_factor_;
   }
 
+  /**
+   * @brief Get a hash of the data that defines the problem (T, b, Jk, L and
+   * the scaling factor). The name and date stamp are left out, so the same
+   * problem submitted again has the same hash.
+   */
+  [[nodiscard]] std::uint64_t getContentHash() const;
+
+  /**
+   * @brief Get a copy of the instance where the sliding bars can only observe
+   * some of their objects and the telescope has less time. The objects keep
+   * their ids, so a solution of the copy is also a solution of this instance.
+   *
+   * @param objects The objects that can still be observed
+   * @param time_limit The time limit of the copy
+   */
+  [[nodiscard]] OpsInstance
+  restrictTo(const std::vector<unsigned int> &objects, int time_limit) const;
+
+  // ------------------------------ Setters -------------------------------- //
+
+  /**
+   * @brief Replaces the profit (or priority) of every object, keeping the
+   * rest of the instance.
+   *
+   * @param priorities The new profit of each object, including the origin
+   * and ending objects.
+   */
+  void setPriorities(std::vector<int> priorities) {
+    priorities_ = std::move(priorities);
+  }
+
   // ------------------------------ Operators ------------------------------ //
 
   /**
@@ -113,6 +158,21 @@ class OpsInstance {
   friend std::istream &
   operator>>(std::istream &input_stream, OpsInstance &ops_instance);
 
+ protected:
+  // ------------------------------ Setters -------------------------------- //
+
+  /**
+   * @brief Replaces the objects that can be observed by the 'k' sliding bar
+   *
+   * @param sliding_bar_idx The index of the sliding bar
+   * @param objects The objects that can be observed by the sliding bar
+   */
+  void setObjectsPerSlidingBar(
+    const std::size_t sliding_bar_idx, std::vector<unsigned int> objects
+  ) {
+    objects_per_sliding_bar_[sliding_bar_idx] = std::move(objects);
+  }
+
  private:
   // ------------------------- Instance Attributes ------------------------- //
 
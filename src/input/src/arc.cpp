@@ -30,17 +30,11 @@
 
 namespace emir {
 
-unsigned int Arc::id_counter_ = 0;
-
-void Arc::resetIdCounter() {
-  Arc::id_counter_ = 0;
-}
-
 Arc::Arc(
-  std::shared_ptr<Node> origin, const int cost,
+  const unsigned int id, std::shared_ptr<Node> origin, const int cost,
   std::shared_ptr<Node> destination
 ) :
-  id_ {Arc::id_counter_++}, origin_ {std::move(origin)}, cost_ {cost},
+  id_ {id}, origin_ {std::move(origin)}, cost_ {cost},
   destination_ {std::move(destination)} {
   const auto &arc = std::make_shared<Arc>(*this);
   origin_->addSuccessor(destination_, arc);
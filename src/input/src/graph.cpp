@@ -23,6 +23,7 @@
 // clang-format on
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <graph.hpp>
@@ -30,12 +31,42 @@
 
 namespace emir {
 
+// -------------------------------- Getters -------------------------------- //
+
+std::optional<unsigned int> Graph::getArcId(const ArcEndpoints arc_endpoints
+) const {
+  for (const auto &arc : arcs_) {
+    if (arc.getOriginId() == arc_endpoints.origin_id &&
+        arc.getDestinationId() == arc_endpoints.destination_id) {
+      return arc.getId();
+    }
+  }
+  return std::nullopt;
+}
+
 // -------------------------------- Adders -------------------------------- //
 
-void Graph::addArc(const ArcEndpoints end_points, const int cost) {
+void Graph::addArc(
+  const ArcEndpoints end_points, const int cost, const unsigned int arc_id
+) {
   const auto &from_node = searchNode(end_points.origin_id);
   const auto &to_node = searchNode(end_points.destination_id);
-  arcs_.emplace_back(from_node, cost, to_node);
+  arcs_.emplace_back(arc_id, from_node, cost, to_node);
+}
+
+// -------------------------------- Utility -------------------------------- //
+
+Graph Graph::clone() const {
+  Graph graph;
+  graph.arcs_.reserve(arcs_.size());
+  for (const auto &arc : arcs_) {
+    graph.addArc(
+      {.origin_id = arc.getOriginId(),
+       .destination_id = arc.getDestinationId()},
+      arc.getCost(), arc.getId()
+    );
+  }
+  return graph;
 }
 
 // ---------------------------- Private Methods ---------------------------- //
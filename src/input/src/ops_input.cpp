@@ -25,16 +25,19 @@
 
 #include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
 
-#include <arc.hpp>
 #include <graph.hpp>
+#include <memory.hpp>
 #include <ops_input.hpp>
 #include <ops_instance.hpp>
+#include <phase.hpp>
 
 namespace emir {
 
-OpsInput::~OpsInput() {
-  Arc::resetIdCounter();
+OpsInput::OpsInput(const OpsInstance &instance) : OpsInstance(instance) {
+  createGraphs();
 }
 
 // -------------------------------- Getters -------------------------------- //
@@ -49,6 +52,110 @@ unsigned int OpsInput::getMaxArc() const {
   return max_arc;
 }
 
+std::size_t OpsInput::getAmountOfArcs() const {
+  std::size_t amount_of_arcs = 0;
+  for (const auto &graph : graphs_) {
+    amount_of_arcs += graph.getArcs().size();
+  }
+  return amount_of_arcs;
+}
+
+std::vector<NestedSlidingBars> OpsInput::getNestedSlidingBars() const {
+  const auto amount_of_sliding_bars = (int)getAmountOfSlidingBars();
+  std::vector<std::vector<unsigned int>> sorted_objects;
+  for (int k = 0; k < amount_of_sliding_bars; ++k) {
+    auto objects = getObjectsPerSlidingBar(k);
+    std::ranges::sort(objects);
+    sorted_objects.push_back(std::move(objects));
+  }
+  std::vector<NestedSlidingBars> nested_sliding_bars;
+  std::vector<int> representatives;
+  for (int k = 0; k < amount_of_sliding_bars; ++k) {
+    if (sorted_objects[k].empty() || !hasPositiveTimes(sorted_objects[k])) {
+      continue;
+    }
+    const auto equal_representative =
+      std::ranges::find_if(representatives, [&](const int representative) {
+        return sorted_objects[representative] == sorted_objects[k];
+      });
+    if (equal_representative != representatives.end()) {
+      nested_sliding_bars.push_back(
+        {.inner_idx = k, .outer_idx = *equal_representative, .are_equal = true}
+      );
+    } else {
+      representatives.push_back(k);
+    }
+  }
+  // Pairing each sliding bar with the smallest one that contains it is
+  // enough, the rest of the inclusions follow from the chain
+  for (const auto &inner_idx : representatives) {
+    const auto &inner_objects = sorted_objects[inner_idx];
+    int outer_idx = -1;
+    for (int k = 0; k < amount_of_sliding_bars; ++k) {
+      const auto &outer_objects = sorted_objects[k];
+      if (outer_objects.size() <= inner_objects.size() ||
+          !std::ranges::includes(outer_objects, inner_objects)) {
+        continue;
+      }
+      if (outer_idx == -1 ||
+          outer_objects.size() < sorted_objects[outer_idx].size()) {
+        outer_idx = k;
+      }
+    }
+    if (outer_idx != -1) {
+      nested_sliding_bars.push_back(
+        {.inner_idx = inner_idx, .outer_idx = outer_idx, .are_equal = false}
+      );
+    }
+  }
+  return nested_sliding_bars;
+}
+
+// ------------------------------- Modifiers ------------------------------- //
+
+std::vector<unsigned int> OpsInput::addObjectToSlidingBar(
+  const int graph_idx, const unsigned int object_id
+) {
+  auto objects_in_sliding_bar = getObjectsPerSlidingBar(graph_idx);
+  if (std::ranges::find(objects_in_sliding_bar, object_id) !=
+      objects_in_sliding_bar.end()) {
+    return {};
+  }
+  // The other copies of the input share the nodes of the graph
+  auto graph = graphs_[graph_idx].clone();
+  auto next_arc_id = (unsigned int)getAmountOfArcs();
+  std::vector<unsigned int> new_arcs_id;
+  const auto add_arc = [&](const ArcEndpoints arc_endpoints) {
+    if (graph.getArcId(arc_endpoints)) { return; }
+    graph.addArc(
+      arc_endpoints,
+      getTimeToProcess({arc_endpoints.origin_id, arc_endpoints.destination_id}
+      ),
+      next_arc_id
+    );
+    new_arcs_id.push_back(next_arc_id++);
+  };
+  const auto last_node_id = (unsigned int)getAmountOfObjects() - 1;
+  add_arc({.origin_id = 0, .destination_id = object_id});
+  add_arc({.origin_id = object_id, .destination_id = last_node_id});
+  for (const auto &other_id : objects_in_sliding_bar) {
+    add_arc({.origin_id = object_id, .destination_id = other_id});
+    add_arc({.origin_id = other_id, .destination_id = object_id});
+  }
+  objects_in_sliding_bar.push_back(object_id);
+  setObjectsPerSlidingBar(graph_idx, std::move(objects_in_sliding_bar));
+  graphs_[graph_idx] = std::move(graph);
+  return new_arcs_id;
+}
+
+void OpsInput::removeObjectFromSlidingBar(
+  const int graph_idx, const unsigned int object_id
+) {
+  auto objects_in_sliding_bar = getObjectsPerSlidingBar(graph_idx);
+  std::erase(objects_in_sliding_bar, object_id);
+  setObjectsPerSlidingBar(graph_idx, std::move(objects_in_sliding_bar));
+}
+
 // ------------------------------ Operators ------------------------------ //
 
 std::istream &operator>>(std::istream &input_stream, OpsInput &ops_input) {
@@ -60,35 +167,53 @@ std::istream &operator>>(std::istream &input_stream, OpsInput &ops_input) {
 // --------------------------- Private Methods --------------------------- //
 
 void OpsInput::createGraphs() {
+  const PhaseScope phase("graph build");
+  const AllocationScope allocation_scope(AllocationCategory::kGraphs);
   const auto amount_of_sliding_bars = getAmountOfSlidingBars();
   graphs_.resize(amount_of_sliding_bars);
+  unsigned int next_arc_id = 0;
   for (auto graph_idx = 0; graph_idx < amount_of_sliding_bars; ++graph_idx) {
-    addGraphArcs(graph_idx);
+    addGraphArcs(graph_idx, next_arc_id);
   }
 }
 
-void OpsInput::addGraphArcs(const int graph_idx) {
+void OpsInput::addGraphArcs(const int graph_idx, unsigned int &next_arc_id) {
   auto &graph = graphs_[graph_idx];
   const auto amount_of_objects = (unsigned int)getAmountOfObjects();
   const auto &objects_in_sliding_bar = getObjectsPerSlidingBar(graph_idx);
-  graph.addArc({.origin_id = 0, .destination_id = amount_of_objects - 1}, 0);
+  graph.addArc(
+    {.origin_id = 0, .destination_id = amount_of_objects - 1}, 0, next_arc_id++
+  );
   for (const auto &origin_id : objects_in_sliding_bar) {
     graph.addArc(
       {.origin_id = 0, .destination_id = origin_id},
-      getTimeToProcess({0, origin_id})
+      getTimeToProcess({0, origin_id}), next_arc_id++
     );
     graph.addArc(
       {.origin_id = origin_id, .destination_id = amount_of_objects - 1},
-      getTimeToProcess({origin_id, amount_of_objects - 1})
+      getTimeToProcess({origin_id, amount_of_objects - 1}), next_arc_id++
     );
     for (const auto &destination_id : objects_in_sliding_bar) {
       if (origin_id == destination_id) { continue; }
       graph.addArc(
         {.origin_id = origin_id, .destination_id = destination_id},
-        getTimeToProcess({origin_id, destination_id})
+        getTimeToProcess({origin_id, destination_id}), next_arc_id++
       );
     }
   }
 }
 
+bool OpsInput::hasPositiveTimes(const std::vector<unsigned int> &objects
+) const {
+  for (const auto &origin_id : objects) {
+    for (const auto &destination_id : objects) {
+      if (origin_id != destination_id &&
+          getTimeToProcess({origin_id, destination_id}) <= 0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 }  // namespace emir
\ No newline at end of file
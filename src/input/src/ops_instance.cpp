@@ -23,23 +23,38 @@
  */
 // clang-format on
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
 #include <functions.hpp>
+#include <hash.hpp>
+#include <memory.hpp>
 #include <ops_instance.hpp>
+#include <phase.hpp>
 
 namespace emir {
 
 OpsInstance::OpsInstance(double scaling_factor) :
   scaling_factor_ {scaling_factor} {}
 
+OpsInstance::OpsInstance(
+  const nlohmann::json &json_instance, const double scaling_factor
+) :
+  scaling_factor_ {scaling_factor} {
+  const PhaseScope phase("parse");
+  const AllocationScope allocation_scope(AllocationCategory::kInput);
+  setFromJson(json_instance);
+}
+
 // ------------------------------- Operators ------------------------------- //
 
 std::istream &
 operator>>(std::istream &input_stream, OpsInstance &ops_instance) {
+  const PhaseScope phase("parse");
+  const AllocationScope allocation_scope(AllocationCategory::kInput);
   nlohmann::json json_instance;  // NOLINT(misc-include-cleaner)
   input_stream >> json_instance;
   ops_instance.setFromJson(json_instance);
@@ -48,6 +63,31 @@ operator>>(std::istream &input_stream, OpsInstance &ops_instance) {
 
 // ---------------------------- Private Methods ----------------------------- //
 
+std::uint64_t OpsInstance::getContentHash() const {
+  Fnv1aHasher hasher;
+  hasher.add(time_to_process_.data())
+    .add(priorities_)
+    .add(objects_per_sliding_bar_)
+    .add(time_limit_)
+    .add(scaling_factor_);
+  return hasher.getHash();
+}
+
+OpsInstance OpsInstance::restrictTo(
+  const std::vector<unsigned int> &objects, const int time_limit
+) const {
+  std::vector<bool> is_kept(getAmountOfObjects(), false);
+  for (const auto &object_id : objects) { is_kept[object_id] = true; }
+  OpsInstance instance(*this);
+  for (auto &objects_in_sliding_bar : instance.objects_per_sliding_bar_) {
+    std::erase_if(objects_in_sliding_bar, [&](const unsigned int object_id) {
+      return !is_kept[object_id];
+    });
+  }
+  instance.time_limit_ = time_limit;
+  return instance;
+}
+
 void OpsInstance::setFromJson(const nlohmann::json &json_instance) {
   time_to_process_ = json_instance["T"].get<std::vector<std::vector<int>>>();
   name_ = json_instance["id"][0].get<std::string>();
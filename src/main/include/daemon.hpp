@@ -0,0 +1,65 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file daemon.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the daemon mode, a long-running
+ * process that keeps warm CPLEX environments and worker threads, and solves
+ * the instances received through a Unix domain socket.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef DAEMON_HPP_
+#define DAEMON_HPP_
+
+#include <string>
+
+#include <solver_config.hpp>
+
+/** @brief Configuration of the daemon mode. */
+struct DaemonConfig {
+  // The path to the Unix domain socket where the requests are received.
+  std::string socket_path;
+  // The amount of worker threads, each one with its own CPLEX environment.
+  int workers;
+  // The configuration used by the requests that do not give one.
+  emir::SolverConfig solver_config;
+};
+
+/**
+ * @brief Serves requests until a shutdown request is received.
+ * @details Each message (request or response) is a frame made of a 4 bytes
+ * big-endian payload size, a byte with the format of the payload ('J' for
+ * JSON, 'M' for MessagePack) and the payload. Responses use the format of
+ * their request. The requests are objects with a `type`:
+ * - `solve`: solves the `instance` (same content as the instance files) with
+ * the optional `config` (`tolerance`, `time_limit`, `threads`). The response,
+ * sent once the solve finishes, has the `status` (solved, failed or
+ * cancelled) and the `output`.
+ * - `cancel`: cancels the solve with the given `id`, removing it from the
+ * queue or aborting the search.
+ * - `status`: gets the amount of queued and running solves.
+ * - `shutdown`: cancels every solve and stops the daemon.
+ * A connection waits for each solve to finish before reading the next request,
+ * so cancellations are sent through another connection.
+ *
+ * @param config The configuration of the daemon.
+ */
+void runDaemon(const DaemonConfig &config);
+
+#endif  // DAEMON_HPP_
\ No newline at end of file
@@ -0,0 +1,145 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file difficulty_estimator.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of an estimator of the time needed
+ * to solve an instance, used to order the instances of a batch.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef DIFFICULTY_ESTIMATOR_HPP_
+#define DIFFICULTY_ESTIMATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <ops_input.hpp>
+
+/**
+ * @brief Predicts the time needed to solve an instance from its features,
+ * with a linear model on their logarithms fitted by least squares against the
+ * outputs already recorded.
+ */
+class DifficultyEstimator {
+ public:
+  /** @brief The features of an instance the time is predicted from. */
+  struct Features {
+    // The amount of objects to observe (n).
+    double objects;
+    // The amount of sliding bars (K).
+    double sliding_bars;
+    // The mean Jaccard index between the objects of every pair of sliding
+    // bars, in [0, 1].
+    double overlap;
+    // The time limit divided by the time a sliding bar needs to observe all
+    // its objects (by the shortest arcs), the mean of every sliding bar.
+    double tightness;
+    // The amount of arcs that fit in the time windows of their nodes.
+    double arcs;
+  };
+
+  /**
+   * @brief Creates an estimator that is not calibrated, which predicts a time
+   * proportional to the amount of arcs.
+   */
+  DifficultyEstimator();
+
+  /**
+   * @brief Fits the estimator to the outputs recorded in
+   * _data/<class>/outputs_, each one with the instance of the same name in
+   * _data/<class>/instances_. Without enough outputs the estimator is left
+   * as it is.
+   *
+   * @param data_folder The folder with a subfolder per class.
+   * @return The amount of outputs used.
+   */
+  std::size_t calibrate(const std::string &data_folder);
+
+  /**
+   * @brief Fits the estimator to the given samples by least squares. Without
+   * enough samples the estimator is left as it is.
+   *
+   * @param samples The features of each instance.
+   * @param times The time spent to solve each instance, in milliseconds.
+   * @return The amount of samples used.
+   */
+  std::size_t
+  fit(const std::vector<Features> &samples, const std::vector<double> &times);
+
+  /**
+   * @brief Computes the features of an instance.
+   *
+   * @param input The input of the instance.
+   */
+  [[nodiscard]] static Features computeFeatures(const emir::OpsInput &input);
+
+  /**
+   * @brief Predicts the time to solve an instance, in milliseconds.
+   *
+   * @param features The features of the instance.
+   */
+  [[nodiscard]] double predict(const Features &features) const;
+
+  /** @brief Gets the coefficients of the model, the intercept first. */
+  [[nodiscard]] const auto &getCoefficients() const {
+    return coefficients_;
+  }
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The amount of coefficients of the model: the intercept and one per
+  // feature.
+  static constexpr std::size_t kAmountOfCoefficients = 6;
+  // Weight added to the diagonal of the normal equations, so the model is
+  // defined even with correlated features.
+  static constexpr double kRidge = 1e-6;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The coefficients of the model, the intercept first.
+  std::array<double, kAmountOfCoefficients> coefficients_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Gets the regressors of an instance: 1 and the logarithm of each
+   * feature (the overlap as it is, since it is already in [0, 1]).
+   *
+   * @param features The features of the instance.
+   */
+  [[nodiscard]] static std::array<double, kAmountOfCoefficients>
+  getRegressors(const Features &features);
+
+  /**
+   * @brief Fits the coefficients by least squares, solving the normal
+   * equations with Gaussian elimination.
+   *
+   * @param regressors The regressors of each sample.
+   * @param targets The logarithm of the time of each sample.
+   */
+  void solveNormalEquations(
+    const std::vector<std::array<double, kAmountOfCoefficients>> &regressors,
+    const std::vector<double> &targets
+  );
+};
+
+#endif  // DIFFICULTY_ESTIMATOR_HPP_
\ No newline at end of file
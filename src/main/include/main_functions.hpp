@@ -26,16 +26,45 @@
 #ifndef MAIN_FUNCTIONS_HPP_
 #define MAIN_FUNCTIONS_HPP_
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <input_parser/parser.hpp>
 
+#include <cplex_environment_pool.hpp>
+#include <log_sink.hpp>
+#include <result_cache.hpp>
+#include <solver_config.hpp>
+
 /**
  * @brief Creates a parser for the input arguments.
  * The parser is created with the following options:
  * `--input`: The path to the input file to be processed.
  * `--classes`: The model classes to be processed.
  * `--tolerance`: The tolerance for the solver.
+ * `--regression`: The model classes to compare against their outputs.
+ * `--max-slowdown`: The relative slowdown allowed in the regression mode.
+ * `--trace`: The path to the file where the Chrome trace is written.
+ * `--log`: What to do with the log of the solver.
+ * `--cache`: The directory of the cache of results.
+ * `--cache-max-size`: The maximum size of the cache (in MiB).
+ * `--cache-max-age`: The days an unused result is kept in the cache.
+ * `--daemon`: The socket where the daemon receives the instances.
+ * `--workers`: The amount of instances solved at once (batch, daemon and
+ * scenarios).
+ * `--checkpoint-interval`: The seconds between two checkpoints of a solve.
+ * `--resume`: Whether to resume the solves from their checkpoints.
+ * `--model-cache`: The directory where the extracted models are saved.
+ * `--rolling-horizon`: The amount of windows to solve the instances by parts.
+ * `--scenarios`: The priority vectors to solve the input file with.
+ * `--no-symmetry-breaking`: Whether to leave out the rows of nested bars.
+ * `--user-cuts`: Whether to separate cover and clique cuts.
+ * `--reduced-cost-fixing`: Whether to fix columns before solving.
+ * `--branching`: How CPLEX chooses the variables to branch on.
+ * `--triage`: Whether to bound the instances instead of solving them.
+ * `--heuristic-frequency`: The nodes between two runs of the heuristic.
+ * `--threads`: The amount of threads used by each solver.
  * `--help`: Shows the usage of the program.
  *
  * @return The parser created.
@@ -50,20 +79,76 @@ struct PathConfig {
   std::string output_path;
 };
 
+/** @brief Configuration shared by every instance processed in a run. */
+struct RunConfig {
+  // The parameters of the solvers, passed to them as they are.
+  emir::SolverConfig solver_config;
+  // The formulation chosen by the user, which overrides the one of the
+  // solver configuration. Empty to use the formulation chosen for each class
+  // (see getClassFormulation) when the model classes are processed.
+  std::optional<emir::Formulation> formulation;
+  // What to do with the log of the solver.
+  LogMode log_mode;
+  // The cache of results, null if it is disabled.
+  const ResultCache *cache;
+  // The environments lent to the solvers, null to create one per instance.
+  emir::CplexEnvironmentPool *environments;
+  // The seconds between two checkpoints of a solve, 0 to disable them.
+  int checkpoint_interval;
+  // Whether to resume the solves from the checkpoints of a previous run.
+  bool resume;
+  // The amount of windows the night is split into, 0 to solve the full model.
+  int rolling_horizon_windows;
+  // Whether to solve with CP Optimizer instead of CPLEX.
+  bool use_cp_optimizer;
+};
+
 /**
  * @brief Creates an output file with the solution of the given input file.
+ * If the cache already has the solution of the same problem, solved with the
+ * same configuration, it is used instead of building and solving the model.
+ * The checkpoints of the solve are written to _<output>.checkpoint.json_,
+ * which is removed once the solve finishes. With rolling-horizon windows the
+ * instance is solved by parts, without checkpoints, and with CP Optimizer
+ * (which takes precedence) the formulation and checkpoints are not used.
  *
  * @param path_config The configuration with the input and output paths.
- * @param tolerance The tolerance for the solver.
+ * @param run_config The configuration of the run.
+ */
+void processInstance(
+  const PathConfig &path_config, const RunConfig &run_config
+);
+
+/**
+ * @brief Gets the formulation that solves the instances of a class faster,
+ * written in _data/<class>/formulation_. Without that file the formulation
+ * is chosen by the size of each model.
+ *
+ * @param model_class The class of the instances.
+ * @throw std::invalid_argument If the file has an unknown formulation.
  */
-void processInstance(const PathConfig &path_config, double tolerance);
+emir::Formulation getClassFormulation(const std::string &model_class);
 
 /**
- * @brief Process the model class and generates the output and log files.
+ * @brief Processes the instances of the model classes, generating their
+ * output and log files.
+ * @details The time of each instance is predicted by a DifficultyEstimator
+ * calibrated with the outputs in _data/<class>/outputs_, so the longest
+ * instances are solved first and none of them delays the end of the batch.
+ * With several workers the instances are solved at once and, unless the
+ * threads of the run are given, each one starts with the share of the threads
+ * not used by the running instances that its predicted time has among the
+ * instances the idle workers start next. An instance that fails is reported
+ * and the rest of the batch goes on.
  *
- * @param model_class The model class to be processed.
- * @param tolerance The tolerance for the solver.
+ * @param model_classes The model classes to be processed.
+ * @param run_config The configuration of the run.
+ * @param workers The amount of instances solved at once.
+ * @return True if no instance failed.
  */
-void processModelClass(const std::string &model_class, double tolerance);
+bool processModelClasses(
+  const std::vector<std::string> &model_classes, const RunConfig &run_config,
+  int workers
+);
 
 #endif  // MAIN_FUNCTIONS_HPP_
\ No newline at end of file
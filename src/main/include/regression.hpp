@@ -0,0 +1,83 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file regression.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the declarations of the performance regression
+ * runner, which re-solves a model class and compares the results against the
+ * reference outputs stored with it.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef REGRESSION_HPP_
+#define REGRESSION_HPP_
+
+#include <iostream>
+#include <string>
+
+#include <solver_config.hpp>
+
+/** @brief Configuration of a performance regression run. */
+struct RegressionConfig {
+  // The parameters of the solvers, the same ones the batch mode uses.
+  emir::SolverConfig solver_config;
+  // Whether to use the formulation chosen for each class (see
+  // getClassFormulation) instead of the one of the solver configuration.
+  bool class_formulation;
+  // Maximum relative slowdown allowed (0.25 means 25% slower than baseline).
+  double max_slowdown;
+};
+
+/** @brief A measure of the new run next to the one stored as baseline. */
+struct RegressionMeasure {
+  // The value measured in the new run.
+  long current;
+  // The value stored in the reference output, -1 if it was not stored.
+  long baseline;
+};
+
+/** @brief Result of re-solving an instance compared to its baseline. */
+struct RegressionResult {
+  // Name of the instance file.
+  std::string instance;
+  // Profit of the solution.
+  RegressionMeasure profit;
+  // Time spent to solve the problem (in milliseconds).
+  RegressionMeasure time_elapsed;
+  // Amount of branch and bound nodes explored.
+  RegressionMeasure nodes;
+  // Time spent to build the model (in milliseconds).
+  RegressionMeasure build_time;
+};
+
+/**
+ * @brief Re-solves every instance of the model class and compares the profit,
+ * runtime, node count and build time against the reference outputs. Prints a
+ * table with the speedup (or slowdown) of each instance.
+ *
+ * @param model_class The model class to be checked.
+ * @param config The configuration of the regression run.
+ * @param report_os The outflow where the table will be printed.
+ * @return True if no instance changed its profit or got slower than allowed.
+ */
+bool checkModelClassRegression(
+  const std::string &model_class, const RegressionConfig &config,
+  std::ostream &report_os
+);
+
+#endif  // REGRESSION_HPP_
\ No newline at end of file
@@ -0,0 +1,69 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file scenarios.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the declarations of the scenario mode, which solves
+ * one instance under several priority vectors to study how robust its plans
+ * are.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef SCENARIOS_HPP_
+#define SCENARIOS_HPP_
+
+#include <string>
+
+#include <cplex_environment_pool.hpp>
+#include <solver_config.hpp>
+
+/** @brief Configuration of the scenario mode. */
+struct ScenarioConfig {
+  // The path to the instance file.
+  std::string instance_path;
+  // The path to the JSON file with the priority vectors.
+  std::string scenarios_path;
+  // The path to the file where the report is written.
+  std::string output_path;
+  // The amount of scenarios solved at once.
+  int workers;
+  // The configuration of the solvers.
+  emir::SolverConfig solver_config;
+};
+
+/**
+ * @brief Solves the instance under each scenario and writes a JSON report
+ * with the profit of each one and a profit matrix, where the row i and column
+ * j holds the profit of the plan of scenario i under the priorities of
+ * scenario j.
+ * @details The scenarios file is a list where each element is either a
+ * priority vector (same as `b`) or an object with its `name` and `b`. The
+ * instance is parsed (and its graphs built) once. Each worker extracts one
+ * model in an environment leased from the pool and goes through the
+ * scenarios only updating the objective, starting each search from its
+ * previous plan and from the plan of the closest scenario already solved.
+ *
+ * @param config The configuration of the scenario mode.
+ * @param environments The pool the environments are leased from.
+ * @throw OpsError If a scenario does not have a priority per object.
+ */
+void runScenarios(
+  const ScenarioConfig &config, emir::CplexEnvironmentPool &environments
+);
+
+#endif  // SCENARIOS_HPP_
\ No newline at end of file
@@ -0,0 +1,66 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file triage.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the declarations of the triage mode, which bounds
+ * the profit of the instances without solving them, so they can be queued by
+ * how much they are worth and how hard they are.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef TRIAGE_HPP_
+#define TRIAGE_HPP_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ops_input.hpp>
+#include <solver_config.hpp>
+
+/**
+ * @brief Bounds the profit with a fractional knapsack per sliding bar: every
+ * object observed takes at least the shortest arc entering it, and its
+ * priority is split among the sliding bars that can observe it, so the profit
+ * of any plan is the sum of the profit it gets in each sliding bar.
+ *
+ * @param input The input of the instance.
+ */
+double getKnapsackBound(const emir::OpsInput &input);
+
+/**
+ * @brief Writes a JSON report for each instance with its bounds, its
+ * estimated hardness and a recommended configuration of the solver.
+ * @details The lower bound is the profit of the greedy plan. The upper bound
+ * is the lowest between the relaxation of the model and a fractional
+ * knapsack per sliding bar, where each object takes the shortest time to
+ * reach it and its priority is split among the sliding bars that can observe
+ * it. The model is built and its relaxation solved, but it is never searched,
+ * so each instance takes a few milliseconds.
+ *
+ * @param instance_paths The paths to the instance files.
+ * @param solver_config The configuration the model is built with.
+ * @param output_os The stream where the reports are written, as a JSON list.
+ */
+void runTriage(
+  const std::vector<std::string> &instance_paths,
+  const emir::SolverConfig &solver_config, std::ostream &output_os
+);
+
+#endif  // TRIAGE_HPP_
\ No newline at end of file
@@ -0,0 +1,581 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file daemon.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the daemon mode.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <format>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <ilcplex/ilocplex.h>
+#include <nlohmann/json.hpp>
+
+#include <daemon.hpp>
+#include <log_sink.hpp>
+#include <memory.hpp>
+#include <ops_cplex_solver.hpp>
+#include <ops_error.hpp>
+#include <ops_input.hpp>
+#include <ops_instance.hpp>
+#include <solver_config.hpp>
+#include <trace.hpp>
+
+namespace {
+
+// ------------------------------- Framing --------------------------------- //
+
+/** @brief Format of the payload of a frame. */
+enum class PayloadFormat : char {
+  kJson = 'J',
+  kMessagePack = 'M',
+};
+
+/** @brief A message received or sent through the socket. */
+struct Frame {
+  // The format of the payload.
+  PayloadFormat format;
+  // The encoded message.
+  std::string payload;
+};
+
+// The size of the header of a frame (payload size and format).
+constexpr std::size_t kFrameHeaderSize = 5;
+// The maximum size of a payload (64 MiB).
+constexpr std::uint32_t kMaxPayloadSize = 64U << 20U;
+// The amount of pending connections the socket accepts.
+constexpr int kListenBacklog = 16;
+
+/**
+ * @brief Reads exactly the given amount of bytes.
+ *
+ * @param descriptor The socket to read from.
+ * @param data Where the bytes are stored.
+ * @param size The amount of bytes to read.
+ * @return Whether every byte was read.
+ */
+bool readAll(const int descriptor, char *data, std::size_t size) {
+  while (size > 0) {
+    const auto amount = ::read(descriptor, data, size);
+    if (amount < 0 && errno == EINTR) { continue; }
+    if (amount <= 0) { return false; }
+    data += amount;
+    size -= (std::size_t)amount;
+  }
+  return true;
+}
+
+/**
+ * @brief Writes every given byte.
+ *
+ * @param descriptor The socket to write to.
+ * @param data The bytes to write.
+ * @return Whether every byte was written.
+ */
+bool writeAll(const int descriptor, std::string_view data) {
+  while (!data.empty()) {
+    const auto amount =
+      ::send(descriptor, data.data(), data.size(), MSG_NOSIGNAL);
+    if (amount < 0 && errno == EINTR) { continue; }
+    if (amount <= 0) { return false; }
+    data.remove_prefix((std::size_t)amount);
+  }
+  return true;
+}
+
+/**
+ * @brief Reads the next frame of a connection.
+ *
+ * @param descriptor The socket to read from.
+ * @return The frame, or nothing if the connection was closed or the frame is
+ * not valid.
+ */
+std::optional<Frame> readFrame(const int descriptor) {
+  std::array<char, kFrameHeaderSize> header {};
+  if (!readAll(descriptor, header.data(), header.size())) {
+    return std::nullopt;
+  }
+  std::uint32_t payload_size = 0;
+  for (std::size_t idx = 0; idx < 4; ++idx) {
+    payload_size = (payload_size << 8U) | (std::uint8_t)header[idx];
+  }
+  const auto format = static_cast<PayloadFormat>(header[4]);
+  if (payload_size > kMaxPayloadSize ||
+      (format != PayloadFormat::kJson &&
+       format != PayloadFormat::kMessagePack)) {
+    return std::nullopt;
+  }
+  Frame frame {.format = format, .payload = std::string(payload_size, '\0')};
+  if (!readAll(descriptor, frame.payload.data(), payload_size)) {
+    return std::nullopt;
+  }
+  return frame;
+}
+
+/**
+ * @brief Encodes a message and writes it as a frame.
+ *
+ * @param descriptor The socket to write to.
+ * @param format The format used to encode the message.
+ * @param message The message to write.
+ * @return Whether the frame was written.
+ */
+bool writeFrame(
+  const int descriptor, const PayloadFormat format,
+  const nlohmann::json &message
+) {
+  std::string payload;
+  if (format == PayloadFormat::kJson) {
+    payload = message.dump();
+  } else {
+    const auto bytes = nlohmann::json::to_msgpack(message);
+    payload.assign(bytes.begin(), bytes.end());
+  }
+  std::string header(kFrameHeaderSize, '\0');
+  const auto payload_size = (std::uint32_t)payload.size();
+  for (std::size_t idx = 0; idx < 4; ++idx) {
+    header[idx] = (char)((payload_size >> (8U * (3 - idx))) & 0xFFU);
+  }
+  header[4] = static_cast<char>(format);
+  return writeAll(descriptor, header) && writeAll(descriptor, payload);
+}
+
+/**
+ * @brief Decodes the payload of a frame.
+ *
+ * @param frame The frame to decode.
+ */
+nlohmann::json decodeFrame(const Frame &frame) {
+  if (frame.format == PayloadFormat::kJson) {
+    return nlohmann::json::parse(frame.payload);
+  }
+  return nlohmann::json::from_msgpack(frame.payload);
+}
+
+// -------------------------------- Solves --------------------------------- //
+
+/** @brief The states a solve goes through. */
+enum class SolveState : std::uint8_t {
+  kQueued,
+  kRunning,
+  kCancelled,
+};
+
+/** @brief A solve requested by a client. */
+struct SolveJob {
+  // The identifier of the solve, used to cancel it.
+  std::string id;
+  // The instance to solve.
+  nlohmann::json instance;
+  // The configuration of the solver.
+  emir::SolverConfig config;
+  // The state of the solve (guarded by the mutex of the daemon).
+  SolveState state = SolveState::kQueued;
+  // Stops the search while it is running (guarded by the mutex of the daemon).
+  IloCplex::Aborter *aborter = nullptr;
+  // The response to send to the client.
+  std::promise<nlohmann::json> response;
+};
+
+/**
+ * @brief Gets the configuration of a solve request.
+ *
+ * @param request The solve request.
+ * @param default_config The configuration used for the missing fields.
+ */
+emir::SolverConfig readSolverConfig(
+  const nlohmann::json &request, emir::SolverConfig default_config
+) {
+  if (!request.contains("config")) { return default_config; }
+  const auto &config = request.at("config");
+  default_config.tolerance =
+    config.value("tolerance", default_config.tolerance);
+  default_config.time_limit =
+    config.value("time_limit", default_config.time_limit);
+  default_config.threads = config.value("threads", default_config.threads);
+  return default_config;
+}
+
+/**
+ * @brief Builds and solves the model of a job in the given environment.
+ *
+ * @param job The job to solve.
+ * @param environment The environment of the worker.
+ * @param aborter The aborter that stops the search.
+ * @return The response for the client.
+ */
+nlohmann::json solveJob(
+  const SolveJob &job, const IloEnv &environment,
+  const IloCplex::Aborter &aborter
+) {
+  OPS_TRACE_SPAN(std::format("job {}", job.id));
+  nlohmann::json response {{"id", job.id}, {"status", "failed"}};
+  try {
+    MemoryProfile::current().clear();
+    DiscardLogSink log_sink;
+    emir::OpsCplexSolver solver(
+      emir::OpsInput(emir::OpsInstance(job.instance)), job.config, environment
+    );
+    solver.addLog(log_sink.getStream());
+    solver.addAborter(aborter);
+    solver.solve();
+    // The output is only set when the search finds a solution
+    if (solver.getOutput().getTimeSpent() >= 0) {
+      std::stringstream output;
+      output << solver;
+      response["status"] = "solved";
+      response["output"] = nlohmann::json::parse(output);
+    }
+  } catch (const std::exception &exception) {
+    response["error"] = exception.what();
+  } catch (const IloException &exception) {
+    response["error"] = exception.getMessage();
+  }
+  return response;
+}
+
+// -------------------------------- Daemon --------------------------------- //
+
+/** @brief Receives requests and solves them in a pool of workers. */
+class SolverDaemon {
+ public:
+  /**
+   * @brief Opens the socket and starts the workers.
+   *
+   * @param config The configuration of the daemon.
+   */
+  explicit SolverDaemon(DaemonConfig config);
+
+  /** @brief Stops the workers and removes the socket. */
+  ~SolverDaemon();
+
+  SolverDaemon(const SolverDaemon &) = delete;
+  SolverDaemon(SolverDaemon &&) = delete;
+  SolverDaemon &operator=(const SolverDaemon &) = delete;
+  SolverDaemon &operator=(SolverDaemon &&) = delete;
+
+  /** @brief Accepts connections until the daemon is stopped. */
+  void run();
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The configuration of the daemon.
+  DaemonConfig config_;
+  // The socket where the connections are accepted.
+  int server_descriptor_ = -1;
+  // Whether the daemon is stopping.
+  bool stopping_ = false;
+  // The amount of solves received, used to name the ones without id.
+  long solve_counter_ = 0;
+  // The solves waiting for a worker.
+  std::deque<std::shared_ptr<SolveJob>> queue_;
+  // The solves queued or running, by id.
+  std::unordered_map<std::string, std::shared_ptr<SolveJob>> jobs_;
+  // The threads that serve each open connection, by socket.
+  std::unordered_map<int, std::thread> connections_;
+  // The threads of the closed connections, waiting to be joined.
+  std::vector<std::thread> finished_connections_;
+  // Protects every attribute above.
+  std::mutex mutex_;
+  // Wakes up the workers when there is a solve queued.
+  std::condition_variable queue_condition_;
+  // Notifies that a connection has been closed.
+  std::condition_variable connection_condition_;
+  // The threads that solve the jobs.
+  std::vector<std::thread> workers_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /** @brief Solves the queued jobs with its own environment. */
+  void workerLoop();
+
+  /**
+   * @brief Reads the requests of a connection and answers them.
+   *
+   * @param descriptor The socket of the connection.
+   */
+  void serveConnection(int descriptor);
+
+  /**
+   * @brief Handles a request.
+   *
+   * @param request The request received.
+   * @return The response for the client.
+   */
+  nlohmann::json handleRequest(const nlohmann::json &request);
+
+  /**
+   * @brief Queues a solve and waits for its response.
+   *
+   * @param request The solve request.
+   */
+  nlohmann::json submit(const nlohmann::json &request);
+
+  /**
+   * @brief Cancels a queued or running solve. The mutex must be locked.
+   *
+   * @param id The identifier of the solve.
+   */
+  nlohmann::json cancel(const std::string &id);
+
+  /** @brief Joins the threads of the closed connections. */
+  void joinFinishedConnections();
+
+  /** @brief Gets the amount of queued and running solves. */
+  nlohmann::json getStatus();
+
+  /** @brief Cancels every solve and stops accepting connections. */
+  void stop();
+};
+
+SolverDaemon::SolverDaemon(DaemonConfig config) : config_ {std::move(config)} {
+  sockaddr_un address {};
+  address.sun_family = AF_UNIX;
+  if (config_.socket_path.size() >= sizeof(address.sun_path)) {
+    throw emir::OpsError(
+      "The socket path is too long: {}", config_.socket_path
+    );
+  }
+  std::ranges::copy(config_.socket_path, address.sun_path);
+  server_descriptor_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (server_descriptor_ < 0) {
+    throw emir::OpsError(
+      "Could not create the socket: {}", std::strerror(errno)
+    );
+  }
+  ::unlink(config_.socket_path.c_str());
+  if (::bind(
+        server_descriptor_, reinterpret_cast<sockaddr *>(&address),
+        sizeof(address)
+      ) < 0 ||
+      ::listen(server_descriptor_, kListenBacklog) < 0) {
+    const auto error = errno;
+    ::close(server_descriptor_);
+    throw emir::OpsError(
+      "Could not listen on {}: {}", config_.socket_path, std::strerror(error)
+    );
+  }
+  MemoryProfile::setConcurrent(config_.workers > 1);
+  for (int idx = 0; idx < config_.workers; ++idx) {
+    workers_.emplace_back(&SolverDaemon::workerLoop, this);
+  }
+}
+
+SolverDaemon::~SolverDaemon() {
+  stop();
+  {
+    std::unique_lock lock(mutex_);
+    connection_condition_.wait(lock, [this] { return connections_.empty(); });
+    joinFinishedConnections();
+  }
+  for (auto &worker : workers_) { worker.join(); }
+  ::close(server_descriptor_);
+  ::unlink(config_.socket_path.c_str());
+}
+
+void SolverDaemon::run() {
+  while (true) {
+    const int descriptor =
+      ::accept4(server_descriptor_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (descriptor < 0 && errno == EINTR) { continue; }
+    if (descriptor < 0) { break; }
+    const std::lock_guard lock(mutex_);
+    joinFinishedConnections();
+    if (stopping_) {
+      ::close(descriptor);
+      break;
+    }
+    connections_.emplace(
+      descriptor,
+      std::thread(&SolverDaemon::serveConnection, this, descriptor)
+    );
+  }
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+void SolverDaemon::workerLoop() {
+  OPS_TRACE_THREAD_NAME("worker");
+  // Created once and reused by every solve of the worker
+  IloEnv environment;
+  while (true) {
+    std::shared_ptr<SolveJob> job;
+    {
+      std::unique_lock lock(mutex_);
+      queue_condition_.wait(lock, [this] {
+        return stopping_ || !queue_.empty();
+      });
+      if (queue_.empty()) { break; }
+      job = queue_.front();
+      queue_.pop_front();
+      job->state = SolveState::kRunning;
+    }
+    IloCplex::Aborter aborter(environment);
+    {
+      const std::lock_guard lock(mutex_);
+      job->aborter = &aborter;
+      // The solve could have been cancelled before the aborter existed
+      if (job->state == SolveState::kCancelled) { aborter.abort(); }
+    }
+    auto response = solveJob(*job, environment, aborter);
+    {
+      const std::lock_guard lock(mutex_);
+      job->aborter = nullptr;
+      jobs_.erase(job->id);
+      if (job->state == SolveState::kCancelled) {
+        response["status"] = "cancelled";
+      }
+    }
+    aborter.end();
+    job->response.set_value(std::move(response));
+  }
+  environment.end();
+}
+
+void SolverDaemon::serveConnection(const int descriptor) {
+  OPS_TRACE_THREAD_NAME("connection");
+  while (const auto frame = readFrame(descriptor)) {
+    nlohmann::json response;
+    try {
+      response = handleRequest(decodeFrame(*frame));
+    } catch (const std::exception &exception) {
+      response = {{"status", "error"}, {"error", exception.what()}};
+    }
+    if (!writeFrame(descriptor, frame->format, response)) { break; }
+  }
+  const std::lock_guard lock(mutex_);
+  // The thread cannot join itself, the accept loop will do it
+  const auto connection = connections_.find(descriptor);
+  finished_connections_.push_back(std::move(connection->second));
+  connections_.erase(connection);
+  ::close(descriptor);
+  connection_condition_.notify_all();
+}
+
+nlohmann::json SolverDaemon::handleRequest(const nlohmann::json &request) {
+  const auto type = request.at("type").get<std::string>();
+  if (type == "solve") { return submit(request); }
+  if (type == "cancel") {
+    const std::lock_guard lock(mutex_);
+    return cancel(request.at("id").get<std::string>());
+  }
+  if (type == "status") { return getStatus(); }
+  if (type == "shutdown") {
+    stop();
+    return {{"status", "stopping"}};
+  }
+  throw emir::OpsError("Unknown request type: {}", type);
+}
+
+nlohmann::json SolverDaemon::submit(const nlohmann::json &request) {
+  auto job = std::make_shared<SolveJob>();
+  job->instance = request.at("instance");
+  job->config = readSolverConfig(request, config_.solver_config);
+  auto response = job->response.get_future();
+  {
+    const std::lock_guard lock(mutex_);
+    if (stopping_) { throw emir::OpsError("The daemon is stopping"); }
+    job->id = request.contains("id")
+                ? request.at("id").get<std::string>()
+                : std::format("solve-{}", ++solve_counter_);
+    if (jobs_.contains(job->id)) {
+      throw emir::OpsError("There is already a solve with id {}", job->id);
+    }
+    jobs_[job->id] = job;
+    queue_.push_back(job);
+  }
+  queue_condition_.notify_one();
+  return response.get();
+}
+
+nlohmann::json SolverDaemon::cancel(const std::string &id) {
+  const auto iterator = jobs_.find(id);
+  if (iterator == jobs_.end()) { return {{"id", id}, {"status", "unknown"}}; }
+  const auto job = iterator->second;
+  if (job->state == SolveState::kQueued) {
+    std::erase(queue_, job);
+    jobs_.erase(iterator);
+    job->state = SolveState::kCancelled;
+    const nlohmann::json response {{"id", id}, {"status", "cancelled"}};
+    job->response.set_value(response);
+    return response;
+  }
+  job->state = SolveState::kCancelled;
+  if (job->aborter != nullptr) { job->aborter->abort(); }
+  return {{"id", id}, {"status", "cancelling"}};
+}
+
+nlohmann::json SolverDaemon::getStatus() {
+  const std::lock_guard lock(mutex_);
+  return {
+    {"queued", queue_.size()},
+    {"running", jobs_.size() - queue_.size()},
+    {"workers", workers_.size()}
+  };
+}
+
+void SolverDaemon::joinFinishedConnections() {
+  for (auto &connection : finished_connections_) { connection.join(); }
+  finished_connections_.clear();
+}
+
+void SolverDaemon::stop() {
+  const std::lock_guard lock(mutex_);
+  if (stopping_) { return; }
+  stopping_ = true;
+  std::vector<std::string> ids;
+  for (const auto &[id, job] : jobs_) { ids.push_back(id); }
+  for (const auto &id : ids) { cancel(id); }
+  // Wakes up the accept and the connections waiting for a request
+  ::shutdown(server_descriptor_, SHUT_RDWR);
+  for (const auto &[descriptor, connection] : connections_) {
+    ::shutdown(descriptor, SHUT_RD);
+  }
+  queue_condition_.notify_all();
+}
+
+}  // namespace
+
+void runDaemon(const DaemonConfig &config) {
+  SolverDaemon daemon(config);
+  daemon.run();
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file difficulty_estimator.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the estimator of the time
+ * needed to solve an instance.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <difficulty_estimator.hpp>
+#include <functions.hpp>
+#include <time_expanded_network.hpp>
+
+namespace fs = std::filesystem;
+
+DifficultyEstimator::DifficultyEstimator() :
+  coefficients_ {0.0, 0.0, 0.0, 0.0, 0.0, 1.0} {}
+
+std::size_t DifficultyEstimator::calibrate(const std::string &data_folder) {
+  std::vector<Features> samples;
+  std::vector<double> times;
+  for (const auto &class_folder : fs::directory_iterator(data_folder)) {
+    const auto output_folder = class_folder.path() / "outputs";
+    const auto input_folder = class_folder.path() / "instances";
+    if (!fs::is_directory(output_folder)) { continue; }
+    for (const auto &output_file : fs::directory_iterator(output_folder)) {
+      const auto instance_path = input_folder / output_file.path().filename();
+      if (!fs::exists(instance_path)) { continue; }
+      nlohmann::json output;
+      try {
+        std::ifstream output_stream(output_file.path());
+        output_stream >> output;
+      } catch (const nlohmann::json::exception &) {
+        // The output of an interrupted run
+        continue;
+      }
+      const auto time_elapsed = output.value("time_elapsed", -1L);
+      if (time_elapsed < 0) { continue; }
+      const auto input = createFromFile<emir::OpsInput>(instance_path);
+      samples.push_back(computeFeatures(input));
+      times.push_back((double)time_elapsed);
+    }
+  }
+  return fit(samples, times);
+}
+
+std::size_t DifficultyEstimator::fit(
+  const std::vector<Features> &samples, const std::vector<double> &times
+) {
+  if (samples.size() < kAmountOfCoefficients) { return 0; }
+  std::vector<std::array<double, kAmountOfCoefficients>> regressors;
+  std::vector<double> targets;
+  for (std::size_t sample = 0; sample < samples.size(); ++sample) {
+    regressors.push_back(getRegressors(samples[sample]));
+    targets.push_back(std::log1p(times[sample]));
+  }
+  solveNormalEquations(regressors, targets);
+  return samples.size();
+}
+
+DifficultyEstimator::Features
+DifficultyEstimator::computeFeatures(const emir::OpsInput &input) {
+  const auto amount_of_objects = input.getAmountOfObjects();
+  const auto amount_of_sliding_bars = input.getAmountOfSlidingBars();
+  const auto last_node_id = (unsigned int)amount_of_objects - 1;
+  double overlap = 0;
+  std::vector<std::vector<unsigned int>> objects_per_sliding_bar;
+  for (std::size_t k = 0; k < amount_of_sliding_bars; ++k) {
+    auto objects = input.getObjectsPerSlidingBar(k);
+    std::ranges::sort(objects);
+    objects_per_sliding_bar.push_back(std::move(objects));
+  }
+  for (std::size_t first = 0; first < amount_of_sliding_bars; ++first) {
+    for (std::size_t second = first + 1; second < amount_of_sliding_bars;
+         ++second) {
+      const auto &first_objects = objects_per_sliding_bar[first];
+      const auto &second_objects = objects_per_sliding_bar[second];
+      std::vector<unsigned int> common_objects;
+      std::ranges::set_intersection(
+        first_objects, second_objects, std::back_inserter(common_objects)
+      );
+      const auto union_size =
+        first_objects.size() + second_objects.size() - common_objects.size();
+      if (union_size > 0) {
+        overlap += (double)common_objects.size() / (double)union_size;
+      }
+    }
+  }
+  if (amount_of_sliding_bars > 1) {
+    const auto amount_of_pairs =
+      amount_of_sliding_bars * (amount_of_sliding_bars - 1) / 2;
+    overlap /= (double)amount_of_pairs;
+  }
+  double tightness = 0;
+  double arcs = 0;
+  const auto time_windows =
+    emir::TimeExpandedNetwork::computeTimeWindows(input);
+  for (std::size_t k = 0; k < amount_of_sliding_bars; ++k) {
+    // The time to observe every object of the sliding bar by the shortest
+    // arcs entering them, and to reach the last node
+    std::vector<long> shortest_times(
+      amount_of_objects, std::numeric_limits<long>::max()
+    );
+    for (const auto &arc : input.getGraph((int)k).getArcs()) {
+      const auto origin_id = arc.getOriginId();
+      const auto destination_id = arc.getDestinationId();
+      const long time = input.getTimeToProcess({origin_id, destination_id});
+      shortest_times[destination_id] =
+        std::min(shortest_times[destination_id], time);
+      if (time_windows.earliest[origin_id] + time <=
+          time_windows.latest[destination_id]) {
+        ++arcs;
+      }
+    }
+    long route_time = shortest_times[last_node_id];
+    for (const auto &object_id : objects_per_sliding_bar[k]) {
+      route_time += shortest_times[object_id];
+    }
+    tightness += input.getTimeLimit() / (double)std::max(route_time, 1L);
+  }
+  if (amount_of_sliding_bars > 0) {
+    tightness /= (double)amount_of_sliding_bars;
+  }
+  return {
+    .objects = (double)amount_of_objects - 2,
+    .sliding_bars = (double)amount_of_sliding_bars,
+    .overlap = overlap,
+    .tightness = tightness,
+    .arcs = arcs
+  };
+}
+
+double DifficultyEstimator::predict(const Features &features) const {
+  const auto regressors = getRegressors(features);
+  double log_time = 0;
+  for (std::size_t idx = 0; idx < kAmountOfCoefficients; ++idx) {
+    log_time += coefficients_[idx] * regressors[idx];
+  }
+  return std::max(std::expm1(log_time), 0.0);
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+std::array<double, DifficultyEstimator::kAmountOfCoefficients>
+DifficultyEstimator::getRegressors(const Features &features) {
+  return {
+    1.0,
+    std::log1p(features.objects),
+    std::log1p(features.sliding_bars),
+    features.overlap,
+    std::log(std::max(features.tightness, 1e-6)),
+    std::log1p(features.arcs)
+  };
+}
+
+void DifficultyEstimator::solveNormalEquations(
+  const std::vector<std::array<double, kAmountOfCoefficients>> &regressors,
+  const std::vector<double> &targets
+) {
+  constexpr auto size = kAmountOfCoefficients;
+  // The normal equations (X'X + ridge I) w = X'y, with X'y as the last column
+  std::array<std::array<double, size + 1>, size> system {};
+  for (std::size_t sample = 0; sample < targets.size(); ++sample) {
+    for (std::size_t row = 0; row < size; ++row) {
+      for (std::size_t column = 0; column < size; ++column) {
+        system[row][column] +=
+          regressors[sample][row] * regressors[sample][column];
+      }
+      system[row][size] += regressors[sample][row] * targets[sample];
+    }
+  }
+  for (std::size_t row = 0; row < size; ++row) { system[row][row] += kRidge; }
+  for (std::size_t pivot = 0; pivot < size; ++pivot) {
+    std::size_t best_row = pivot;
+    for (std::size_t row = pivot + 1; row < size; ++row) {
+      if (std::abs(system[row][pivot]) > std::abs(system[best_row][pivot])) {
+        best_row = row;
+      }
+    }
+    // The features do not tell the samples apart, the model is kept
+    if (std::abs(system[best_row][pivot]) < kRidge) { return; }
+    std::swap(system[pivot], system[best_row]);
+    for (std::size_t row = 0; row < size; ++row) {
+      if (row == pivot) { continue; }
+      const double factor = system[row][pivot] / system[pivot][pivot];
+      for (std::size_t column = pivot; column <= size; ++column) {
+        system[row][column] -= factor * system[pivot][column];
+      }
+    }
+  }
+  for (std::size_t row = 0; row < size; ++row) {
+    coefficients_[row] = system[row][size] / system[row][row];
+  }
+}
\ No newline at end of file
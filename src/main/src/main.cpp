@@ -23,16 +23,30 @@
  */
 // clang-format on
 
+#include <chrono>
+#include <cstdint>
 #include <exception>
+#include <filesystem>
+#include <format>
 #include <iostream>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include <input_parser/parser.hpp>
 #include <input_parser/parsing_error.hpp>
 
+#include <cplex_environment_pool.hpp>
+#include <daemon.hpp>
+#include <log_sink.hpp>
 #include <main_functions.hpp>
 #include <ops_error.hpp>
+#include <regression.hpp>
+#include <result_cache.hpp>
+#include <scenarios.hpp>
+#include <solver_config.hpp>
+#include <trace.hpp>
+#include <triage.hpp>
 
 /**
  * @brief Main function to process folders filled with instances and output
@@ -51,16 +65,130 @@ int secureMain(int argc, char *argv[]) {
   const auto &input_path = parser.getValue<std::string>("--input");
   const auto &classes = parser.getValue<std::vector<std::string>>("--classes");
   const auto tolerance = parser.getValue<double>("--tolerance");
+  const auto log_mode =
+    logModeFromString(parser.getValue<std::string>("--log"));
+  const auto &trace_path = parser.getValue<std::string>("--trace");
+  if (!trace_path.empty()) {
+#ifdef OPS_ENABLE_TRACING
+    TraceRecorder::instance().enable(trace_path);
+    OPS_TRACE_THREAD_NAME("main");
+#else
+    std::cerr << "Warning: tracing is disabled, configure the project with "
+                 "-DENABLE_TRACING=ON to use --trace\n";
+#endif
+  }
+  // With auto the formulation is chosen per class
+  const auto &formulation_name = parser.getValue<std::string>("--formulation");
+  const auto formulation =
+    formulation_name == "auto"
+      ? std::nullopt
+      : std::optional(emir::formulationFromString(formulation_name));
+  const emir::SolverConfig solver_config {
+    .tolerance = tolerance,
+    .threads = parser.getValue<int>("--threads"),
+    .model_cache = parser.getValue<std::string>("--model-cache"),
+    .symmetry_breaking = !parser.getValue<bool>("--no-symmetry-breaking"),
+    .user_cuts = parser.getValue<bool>("--user-cuts"),
+    .reduced_cost_fixing = parser.getValue<bool>("--reduced-cost-fixing"),
+    .formulation = formulation.value_or(emir::Formulation::kBySize),
+    .branching =
+      emir::branchingFromString(parser.getValue<std::string>("--branching")),
+    .heuristic_frequency = parser.getValue<int>("--heuristic-frequency")
+  };
+  if (const auto &socket_path = parser.getValue<std::string>("--daemon");
+      !socket_path.empty()) {
+    runDaemon(
+      {.socket_path = socket_path,
+       .workers = parser.getValue<int>("--workers"),
+       .solver_config = solver_config}
+    );
+    TraceRecorder::instance().flush();
+    return 0;
+  }
+  emir::CplexEnvironmentPool environments;
+  if (const auto &scenarios_path = parser.getValue<std::string>("--scenarios");
+      !scenarios_path.empty()) {
+    if (input_path.empty()) {
+      std::cerr << "The scenario mode needs an input file (--input)\n";
+      return 1;
+    }
+    runScenarios(
+      {.instance_path = input_path,
+       .scenarios_path = scenarios_path,
+       .output_path = "scenarios.json",
+       .workers = parser.getValue<int>("--workers"),
+       .solver_config = solver_config},
+      environments
+    );
+    TraceRecorder::instance().flush();
+    return 0;
+  }
+  if (parser.getValue<bool>("--triage")) {
+    std::vector<std::string> instance_paths;
+    if (!input_path.empty()) { instance_paths.push_back(input_path); }
+    for (const auto &model_class : classes) {
+      for (const auto &file : std::filesystem::directory_iterator(
+             std::format("data/{}/instances", model_class)
+           )) {
+        instance_paths.push_back(file.path().string());
+      }
+    }
+    runTriage(instance_paths, solver_config, std::cout);
+    TraceRecorder::instance().flush();
+    return 0;
+  }
+  const auto &regression_classes =
+    parser.getValue<std::vector<std::string>>("--regression");
+  if (!regression_classes.empty()) {
+    const RegressionConfig config {
+      .solver_config = solver_config,
+      .class_formulation = !formulation,
+      .max_slowdown = parser.getValue<double>("--max-slowdown")
+    };
+    bool passed = true;
+    for (const auto &model_class : regression_classes) {
+      std::cout << "Class " << model_class << '\n';
+      passed = checkModelClassRegression(model_class, config, std::cout) &&
+               passed;
+    }
+    return passed ? 0 : 1;
+  }
+  std::optional<ResultCache> cache;
+  if (const auto &cache_path = parser.getValue<std::string>("--cache");
+      !cache_path.empty()) {
+    cache.emplace(
+      cache_path,
+      ResultCacheLimits {
+        .max_bytes =
+          (std::uintmax_t)parser.getValue<int>("--cache-max-size") << 20U,
+        .max_age =
+          std::chrono::days(parser.getValue<int>("--cache-max-age"))
+      }
+    );
+  }
+  const RunConfig run_config {
+    .solver_config = solver_config,
+    .formulation = formulation,
+    .log_mode = log_mode,
+    .cache = cache ? &*cache : nullptr,
+    .environments = &environments,
+    .checkpoint_interval = parser.getValue<int>("--checkpoint-interval"),
+    .resume = parser.getValue<bool>("--resume"),
+    .rolling_horizon_windows = parser.getValue<int>("--rolling-horizon"),
+    .use_cp_optimizer = parser.getValue<std::string>("--solver") == "cp"
+  };
+  bool passed = true;
   if (!input_path.empty()) {
     processInstance(
-      {.input_path = input_path, .output_path = "solution.txt"}, tolerance
+      {.input_path = input_path, .output_path = "solution.txt"}, run_config
     );
   } else if (!classes.empty()) {
-    for (const auto &model_class : classes) {
-      processModelClass(model_class, tolerance);
-    }
+    passed = processModelClasses(
+      classes, run_config, parser.getValue<int>("--workers")
+    );
   }
-  return 0;
+  TraceRecorder::instance().flush();
+  return passed ? 0 : 1;
 }
 
 int main(int argc, char *argv[]) {
@@ -24,21 +24,164 @@
 // clang-format on
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include <ilcplex/ilocplex.h>
 #include <input_parser/parser.hpp>
 
+#include <checkpoint.hpp>
+#include <difficulty_estimator.hpp>
 #include <functions.hpp>
+#include <hash.hpp>
+#include <log_sink.hpp>
 #include <main_functions.hpp>
+#include <memory.hpp>
+#include <ops_cp_solver.hpp>
 #include <ops_cplex_solver.hpp>
+#include <ops_instance.hpp>
+#include <ops_solver.hpp>
+#include <result_cache.hpp>
+#include <rolling_horizon_solver.hpp>
+#include <solver_config.hpp>
+#include <trace.hpp>
 
 namespace fs = std::filesystem;
 
+namespace {
+
+/** @brief An instance of a batch, waiting to be solved. */
+struct BatchJob {
+  // The input and output paths of the instance.
+  PathConfig path_config;
+  // The configuration of its class.
+  RunConfig run_config;
+  // The time it is expected to take, in milliseconds.
+  double predicted_time;
+};
+
+/**
+ * @brief Gets the threads of a job about to start: the share of the free
+ * threads its predicted time has among the jobs the idle workers will start
+ * next (itself included), at least one.
+ *
+ * @param jobs The jobs of the batch, longest first.
+ * @param job_idx The index of the job about to start.
+ * @param idle_workers The workers not running a job, this one included.
+ * @param free_threads The threads not used by the running jobs.
+ */
+int takeThreadShare(
+  const std::vector<BatchJob> &jobs, const std::size_t job_idx,
+  const std::size_t idle_workers, const int free_threads
+) {
+  const auto window_end = std::min(job_idx + idle_workers, jobs.size());
+  double window_time = 0;
+  for (std::size_t idx = job_idx; idx < window_end; ++idx) {
+    window_time += jobs[idx].predicted_time;
+  }
+  const double share = window_time > 0
+                         ? jobs[job_idx].predicted_time / window_time
+                         : 1.0 / (double)(window_end - job_idx);
+  return std::max((int)(std::max(free_threads, 0) * share), 1);
+}
+
+// Version of the cached results. Bump it whenever the model or the format of
+// the output changes, so older results are not used anymore.
+constexpr int kCacheVersion = 2;
+
+/**
+ * @brief Gets the key of the result of an instance in the cache. Every
+ * parameter that changes the output is part of it, except the amount of
+ * threads and the model cache.
+ *
+ * @param instance The instance to solve.
+ * @param solver_config The parameters of the solver.
+ * @param rolling_horizon_windows The amount of windows the night is split
+ * into, 0 if the full model is solved.
+ * @param use_cp_optimizer Whether the instance is solved with CP Optimizer.
+ */
+std::string getCacheKey(
+  const emir::OpsInstance &instance, const emir::SolverConfig &solver_config,
+  const int rolling_horizon_windows, const bool use_cp_optimizer
+) {
+  Fnv1aHasher hasher;
+  hasher.add(kCacheVersion)
+    .add(instance.getContentHash())
+    .add(rolling_horizon_windows)
+    .add(use_cp_optimizer)
+    .add(solver_config.tolerance)
+    .add(solver_config.time_limit)
+    .add(solver_config.symmetry_breaking)
+    .add(solver_config.user_cuts)
+    .add(solver_config.reduced_cost_fixing)
+    .add(std::to_underlying(solver_config.formulation))
+    .add(solver_config.time_bucket)
+    .add(std::to_underlying(solver_config.branching))
+    .add(solver_config.heuristic_frequency)
+    .add(solver_config.heuristic_time_box);
+  return std::format("{:016x}", hasher.getHash());
+}
+
+/**
+ * @brief Prints the last lines of the log kept by a ring sink, so a failed
+ * solve can be examined. Other sinks print nothing.
+ *
+ * @param log_sink The sink the log of the solver was written to.
+ */
+void printRingLog(LogSink &log_sink) {
+  if (auto *ring_sink = dynamic_cast<RingLogSink *>(&log_sink)) {
+    std::cerr << "Last lines of the log:\n" << ring_sink->getContents();
+  }
+}
+
+/**
+ * @brief Formats a value of a progress record, NaN values are unknown.
+ *
+ * @param value The value to format.
+ */
+std::string formatProgressValue(const double value) {
+  return std::isnan(value) ? "null" : std::format("{}", value);
+}
+
+/**
+ * @brief Writes the progress records parsed from the log as a JSON list.
+ *
+ * @param records The records to write.
+ * @param file_path The path to the file where the records are written.
+ */
+void writeProgressRecords(
+  const std::vector<ProgressRecord> &records, const std::string &file_path
+) {
+  std::ofstream progress_file(file_path);
+  progress_file << "[";
+  for (std::size_t idx = 0; idx < records.size(); ++idx) {
+    const auto &record = records[idx];
+    progress_file << std::format(
+      R"({}{{"nodes":{},"nodes_left":{},"incumbent":{},"bound":{},"gap":{}}})",
+      idx == 0 ? "\n  " : ",\n  ", record.nodes, record.nodes_left,
+      formatProgressValue(record.incumbent), formatProgressValue(record.bound),
+      formatProgressValue(record.gap)
+    );
+  }
+  progress_file << "\n]\n";
+}
+
+}  // namespace
+
 input_parser::Parser createParser() {
   return input_parser::Parser()
     .addHelpOption()
@@ -60,10 +203,10 @@ input_parser::Parser createParser() {
         .addConstraint<std::vector<std::string>>(
           [](const auto &values) -> bool {
             return std::ranges::all_of(values, [](const auto &value) {
-              return value == "A" || value == "B" || value == "C";
+              return fs::exists(std::format("data/{}/instances", value));
             });
           },
-          "The classes must be one of the following: A, B, C"
+          "The classes must have a folder with instances"
         )
         .addConstraint<std::vector<std::string>>(
           [](const auto &values) -> bool {
@@ -87,27 +230,486 @@ input_parser::Parser createParser() {
           [](const auto &value) -> bool { return value > 0; },
           "The tolerance must be greater than 0"
         );
+    })
+    .addOption([] {
+      return input_parser::CompoundOption("-r", "--regression")
+        .addDescription(
+          "List of classes to re-solve and compare against their outputs"
+        )
+        .addDefaultValue(std::vector<std::string>())
+        .addConstraint<std::vector<std::string>>(
+          [](const auto &values) -> bool {
+            return std::ranges::all_of(values, [](const auto &value) {
+              return fs::exists(std::format("data/{}/outputs", value));
+            });
+          },
+          "The classes must have a folder with reference outputs"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-s", "--max-slowdown")
+        .addDescription("Relative slowdown allowed in the regression mode")
+        .addDefaultValue(std::string("0.25"))
+        .toDouble()
+        .transformBeforeCheck()
+        .addConstraint<double>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The slowdown allowed must be non-negative"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--trace")
+        .addDescription("Path to the file where the Chrome trace is written")
+        .addDefaultValue(std::string());
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-l", "--log")
+        .addDescription(
+          "What to do with the log of the solver: discard, ring (keep the "
+          "end to show it on errors), file (<output>.log) or progress "
+          "(<output>.progress.json)"
+        )
+        .addDefaultValue(std::string("discard"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "discard" || value == "ring" || value == "file" ||
+                   value == "progress";
+          },
+          "The log mode must be one of the following: discard, ring, file, "
+          "progress"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--cache")
+        .addDescription(
+          "Directory where the results are cached, to skip solving the same "
+          "problem again"
+        )
+        .addDefaultValue(std::string());
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--cache-max-size")
+        .addDescription("Maximum size of the cache (in MiB)")
+        .addDefaultValue(std::string("256"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The maximum size of the cache must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--cache-max-age")
+        .addDescription("Days an unused result is kept in the cache")
+        .addDefaultValue(std::string("30"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The maximum age of the cache entries must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--daemon")
+        .addDescription(
+          "Path to the Unix domain socket where the daemon receives the "
+          "instances to solve"
+        )
+        .addDefaultValue(std::string());
+    })
+    .addOption([] {
+      return input_parser::SingleOption("-w", "--workers")
+        .addDescription(
+          "Amount of instances (or scenarios) solved at once in the batch, "
+          "daemon and scenario modes"
+        )
+        .addDefaultValue(std::string("1"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value > 0; },
+          "The amount of workers must be greater than 0"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--checkpoint-interval")
+        .addDescription(
+          "Seconds between two checkpoints of the incumbent of each solve "
+          "(0 disables them)"
+        )
+        .addDefaultValue(std::string("0"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The checkpoint interval must be non-negative"
+        );
+    })
+    .addOption([] {
+      return input_parser::FlagOption("--resume").addDescription(
+        "Resume each solve from its checkpoint, if a previous run left one"
+      );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--model-cache")
+        .addDescription(
+          "Directory where the extracted models are saved, to load them "
+          "instead of building them again"
+        )
+        .addDefaultValue(std::string());
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--rolling-horizon")
+        .addDescription(
+          "Amount of windows the night is split into to solve each instance "
+          "by parts (0 solves the full model)"
+        )
+        .addDefaultValue(std::string("0"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The amount of windows must be non-negative"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--scenarios")
+        .addDescription(
+          "JSON file with priority vectors to solve the input file with, "
+          "writing the report to scenarios.json"
+        )
+        .addDefaultValue(std::string())
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value.empty() || std::filesystem::exists(value);
+          },
+          "The file must exist!"
+        );
+    })
+    .addOption([] {
+      return input_parser::FlagOption("--no-symmetry-breaking")
+        .addDescription(
+          "Leave out the rows that tie the arcs of the sliding bars contained "
+          "in another one (to measure their effect)"
+        );
+    })
+    .addOption([] {
+      return input_parser::FlagOption("--user-cuts")
+        .addDescription(
+          "Separate cover cuts of the time limit of each sliding bar and "
+          "clique cuts among objects that cannot be observed together"
+        );
+    })
+    .addOption([] {
+      return input_parser::FlagOption("--reduced-cost-fixing")
+        .addDescription(
+          "Fix the columns that cannot improve a greedy plan, by their time "
+          "windows and their reduced costs in the relaxation, before solving"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--formulation")
+        .addDescription(
+          "How the times of the objects are modeled: mtz, time-flow, "
+          "time-indexed, by-size (time-indexed if its network is small enough, "
+          "mtz otherwise) or auto (the one written in "
+          "data/<class>/formulation, by-size without it)"
+        )
+        .addDefaultValue(std::string("auto"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "mtz" || value == "time-flow" ||
+                   value == "time-indexed" || value == "by-size" ||
+                   value == "auto";
+          },
+          "The formulation must be one of the following: mtz, time-flow, "
+          "time-indexed, by-size, auto"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--solver")
+        .addDescription(
+          "The solver used: cplex (the MIP model) or cp (a model of CP "
+          "Optimizer with a sequence of intervals per sliding bar)"
+        )
+        .addDefaultValue(std::string("cplex"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "cplex" || value == "cp";
+          },
+          "The solver must be one of the following: cplex, cp"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--branching")
+        .addDescription(
+          "How CPLEX branches: cplex (its default strategy), priorities (the "
+          "observed objects before the arcs, the most priority per unit of "
+          "time first) or aggregates (the priorities plus branching on the "
+          "amount of objects observed by each sliding bar)"
+        )
+        .addDefaultValue(std::string("cplex"))
+        .addConstraint<std::string>(
+          [](const auto &value) -> bool {
+            return value == "cplex" || value == "priorities" ||
+                   value == "aggregates";
+          },
+          "The branching must be one of the following: cplex, priorities, "
+          "aggregates"
+        );
+    })
+    .addOption([] {
+      return input_parser::FlagOption("--triage")
+        .addDescription(
+          "Print the bounds, hardness and recommended configuration of the "
+          "input file (or the instances of the classes) without solving them"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--heuristic-frequency")
+        .addDescription(
+          "Amount of nodes between two runs of the heuristic that rounds the "
+          "relaxation into a plan (0 disables it)"
+        )
+        .addDefaultValue(std::string("0"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The frequency of the heuristic must be non-negative"
+        );
+    })
+    .addOption([] {
+      return input_parser::SingleOption("--threads")
+        .addDescription(
+          "Amount of threads used by each solver (0 lets CPLEX decide, or "
+          "splits the machine among the workers of the batch mode)"
+        )
+        .addDefaultValue(std::string("0"))
+        .toInt()
+        .transformBeforeCheck()
+        .addConstraint<int>(
+          [](const auto &value) -> bool { return value >= 0; },
+          "The amount of threads must be non-negative"
+        );
     });
 }
 
-void processInstance(const PathConfig &path_config, const double tolerance) {
+void processInstance(
+  const PathConfig &path_config, const RunConfig &run_config
+) {
+  OPS_TRACE_SPAN(fs::path(path_config.input_path).filename().string());
+  MemoryProfile::current().clear();
+  const auto instance =
+    createFromFile<emir::OpsInstance>(path_config.input_path);
+  auto solver_config = run_config.solver_config;
+  if (run_config.formulation) {
+    solver_config.formulation = *run_config.formulation;
+  }
+  const auto cache_key = getCacheKey(
+    instance, solver_config, run_config.rolling_horizon_windows,
+    run_config.use_cp_optimizer
+  );
   std::ofstream output_os(path_config.output_path);
-  std::stringstream string_stream;
-  output_os << solve<emir::OpsCplexSolver>(
-    path_config.input_path, tolerance, string_stream
+  if (run_config.cache != nullptr) {
+    if (const auto cached_output = run_config.cache->load(cache_key)) {
+      output_os << *cached_output;
+      return;
+    }
+  }
+  const auto log_sink =
+    createLogSink(run_config.log_mode, path_config.output_path + ".log");
+  try {
+    // Declared before the solver, so the environment is given back after the
+    // solver is destroyed
+    std::optional<emir::CplexEnvironmentPool::Lease> lease;
+    if (run_config.environments != nullptr) {
+      lease.emplace(run_config.environments->acquire());
+    }
+    const auto checkpoint_path = path_config.output_path + ".checkpoint.json";
+    std::unique_ptr<emir::OpsSolver> solver;
+    if (run_config.use_cp_optimizer) {
+      auto cp_solver =
+        lease ? std::make_unique<emir::OpsCpSolver>(
+                  emir::OpsInput(instance), solver_config,
+                  lease->getEnvironment()
+                )
+              : std::make_unique<emir::OpsCpSolver>(
+                  emir::OpsInput(instance), solver_config
+                );
+      cp_solver->addLog(log_sink->getStream());
+      solver = std::move(cp_solver);
+    } else if (run_config.rolling_horizon_windows > 0) {
+      const emir::RollingHorizonConfig rolling_horizon_config {
+        .windows = run_config.rolling_horizon_windows
+      };
+      auto rolling_horizon_solver =
+        lease ? std::make_unique<emir::RollingHorizonSolver>(
+                  emir::OpsInput(instance), solver_config,
+                  rolling_horizon_config, lease->getEnvironment()
+                )
+              : std::make_unique<emir::RollingHorizonSolver>(
+                  emir::OpsInput(instance), solver_config,
+                  rolling_horizon_config
+                );
+      rolling_horizon_solver->addLog(log_sink->getStream());
+      solver = std::move(rolling_horizon_solver);
+    } else {
+      auto cplex_solver =
+        lease ? std::make_unique<emir::OpsCplexSolver>(
+                  emir::OpsInput(instance), solver_config,
+                  lease->getEnvironment()
+                )
+              : std::make_unique<emir::OpsCplexSolver>(
+                  emir::OpsInput(instance), solver_config
+                );
+      cplex_solver->addLog(log_sink->getStream());
+      if (run_config.resume && fs::exists(checkpoint_path)) {
+        const auto checkpoint = emir::readCheckpoint(checkpoint_path);
+        // Left by an earlier version of the instance, it is solved anew
+        if (checkpoint.instance_hash == instance.getContentHash()) {
+          cplex_solver->resume(checkpoint);
+        } else {
+          std::cerr << std::format(
+            "Skipping {}: it belongs to another instance\n", checkpoint_path
+          );
+        }
+      }
+      if (run_config.checkpoint_interval > 0) {
+        cplex_solver->enableCheckpoints(
+          checkpoint_path, std::chrono::seconds(run_config.checkpoint_interval)
+        );
+      }
+      solver = std::move(cplex_solver);
+    }
+    solver->solve();
+    // The solvers report CPLEX errors and searches without a solution by
+    // leaving the output without the time spent
+    if (solver->getOutput().getTimeSpent() >= 0) {
+      fs::remove(checkpoint_path);
+    } else {
+      printRingLog(*log_sink);
+    }
+    std::ostringstream solution;
+    solution << *solver;
+    output_os << solution.str();
+    // Failed solves leave the output without the time spent
+    if (run_config.cache != nullptr &&
+        solver->getOutput().getTimeSpent() >= 0) {
+      run_config.cache->store(cache_key, solution.str());
+    }
+  } catch (const std::exception &) {
+    printRingLog(*log_sink);
+    throw;
+  } catch (const IloException &) {
+    printRingLog(*log_sink);
+    throw;
+  }
+  if (auto *progress_sink = dynamic_cast<ProgressLogSink *>(log_sink.get())) {
+    writeProgressRecords(
+      progress_sink->getRecords(), path_config.output_path + ".progress.json"
+    );
+  }
+}
+
+emir::Formulation getClassFormulation(const std::string &model_class) {
+  std::ifstream formulation_file(
+    std::format("data/{}/formulation", model_class)
   );
+  std::string name;
+  if (!(formulation_file >> name)) { return emir::Formulation::kBySize; }
+  return emir::formulationFromString(name);
 }
 
-void processModelClass(const std::string &model_class, const double tolerance) {
-  const auto input_folder = std::format("data/{}/instances", model_class);
-  const auto output_folder = std::format("data/{}/outputs/", model_class);
-  if (!fs::exists(output_folder)) { fs::create_directory(output_folder); }
-  for (const auto &file : fs::directory_iterator(input_folder)) {
-    std::cout << file.path() << '\n';
-    processInstance(
-      {.input_path = file.path(),
-       .output_path = output_folder + file.path().filename().string()},
-      tolerance
-    );
+bool processModelClasses(
+  const std::vector<std::string> &model_classes, const RunConfig &run_config,
+  const int workers
+) {
+  DifficultyEstimator estimator;
+  estimator.calibrate("data");
+  std::vector<BatchJob> jobs;
+  for (const auto &model_class : model_classes) {
+    auto class_run_config = run_config;
+    if (!class_run_config.formulation) {
+      class_run_config.formulation = getClassFormulation(model_class);
+    }
+    const auto input_folder = std::format("data/{}/instances", model_class);
+    const auto output_folder = std::format("data/{}/outputs/", model_class);
+    if (!fs::exists(output_folder)) { fs::create_directory(output_folder); }
+    for (const auto &file : fs::directory_iterator(input_folder)) {
+      const auto input = createFromFile<emir::OpsInput>(file.path());
+      jobs.push_back(
+        {.path_config =
+           {.input_path = file.path(),
+            .output_path = output_folder + file.path().filename().string()},
+         .run_config = class_run_config,
+         .predicted_time = estimator.predict(
+           DifficultyEstimator::computeFeatures(input)
+         )}
+      );
+    }
+  }
+  // The longest jobs first, so none of them is left for the end
+  std::ranges::stable_sort(jobs, std::greater {}, &BatchJob::predicted_time);
+  const auto amount_of_jobs = jobs.size();
+  const auto amount_of_workers = (std::size_t)std::max(workers, 1);
+  // With one worker (or the threads given) CPLEX keeps its own amount
+  const bool shares_threads =
+    amount_of_workers > 1 && run_config.solver_config.threads == 0;
+  MemoryProfile::setConcurrent(amount_of_workers > 1);
+  std::mutex mutex;
+  std::size_t next_job = 0;
+  std::size_t running_jobs = 0;
+  int free_threads = (int)std::max(std::thread::hardware_concurrency(), 1U);
+  bool passed = true;
+  const auto run_jobs = [&]([[maybe_unused]] const std::size_t worker_idx) {
+    OPS_TRACE_THREAD_NAME(std::format("batch worker {}", worker_idx));
+    while (true) {
+      std::size_t job_idx = 0;
+      int threads = 0;
+      {
+        const std::lock_guard lock(mutex);
+        if (next_job == amount_of_jobs) { return; }
+        job_idx = next_job++;
+        if (shares_threads) {
+          threads = takeThreadShare(
+            jobs, job_idx, amount_of_workers - running_jobs, free_threads
+          );
+          free_threads -= threads;
+        }
+        ++running_jobs;
+        std::cout << fs::path(jobs[job_idx].path_config.input_path) << '\n';
+      }
+      const auto &[path_config, class_run_config, _] = jobs[job_idx];
+      auto job_run_config = class_run_config;
+      if (shares_threads) { job_run_config.solver_config.threads = threads; }
+      std::optional<std::string> error;
+      try {
+        processInstance(path_config, job_run_config);
+      } catch (const std::exception &exception) {
+        error = exception.what();
+      } catch (const IloException &exception) {
+        error = exception.getMessage();
+      }
+      const std::lock_guard lock(mutex);
+      --running_jobs;
+      free_threads += threads;
+      if (error) {
+        passed = false;
+        std::cerr << std::format(
+          "Error in {}: {}\n", path_config.input_path, *error
+        );
+      }
+    }
+  };
+  {
+    // Joined on every path, the jobs do not let any exception escape
+    std::vector<std::jthread> threads;
+    for (std::size_t idx = 1; idx < amount_of_workers; ++idx) {
+      threads.emplace_back(run_jobs, idx);
+    }
+    run_jobs(0);
   }
+  MemoryProfile::setConcurrent(false);
+  return passed;
 }
\ No newline at end of file
@@ -0,0 +1,203 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file regression.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the performance regression
+ * runner.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <functions.hpp>
+#include <log_sink.hpp>
+#include <main_functions.hpp>
+#include <ops_cplex_solver.hpp>
+#include <ops_input.hpp>
+#include <regression.hpp>
+#include <solver_config.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Differences in time below this amount of milliseconds are considered noise.
+constexpr long kMinTimeDifference = 100;
+// Differences in nodes below this amount are considered noise.
+constexpr long kMinNodesDifference = 100;
+
+/**
+ * @brief Tells if the measure got worse than allowed.
+ *
+ * @param measure The measure to check.
+ * @param max_slowdown Maximum relative slowdown allowed.
+ * @param min_difference Absolute difference below which nothing is reported.
+ */
+bool isSlower(
+  const RegressionMeasure measure, const double max_slowdown,
+  const long min_difference
+) {
+  if (measure.baseline < 0) { return false; }
+  return measure.current - measure.baseline > min_difference &&
+         (double)measure.current >
+           (double)measure.baseline * (1.0 + max_slowdown);
+}
+
+/**
+ * @brief Formats a measure as "baseline -> current (speedup)".
+ *
+ * @param measure The measure to format.
+ */
+std::string formatMeasure(const RegressionMeasure measure) {
+  if (measure.baseline < 0) {
+    return std::format("n/a -> {}", measure.current);
+  }
+  const double speedup = (double)std::max(measure.baseline, 1L) /
+                         (double)std::max(measure.current, 1L);
+  return std::format(
+    "{} -> {} ({:.2f}x)", measure.baseline, measure.current, speedup
+  );
+}
+
+/**
+ * @brief Reads the reference output of an instance.
+ *
+ * @param baseline_path The path to the reference output.
+ * @return The output, or nothing if it is missing, truncated or has no
+ * profit.
+ */
+std::optional<nlohmann::json> readBaseline(const fs::path &baseline_path) {
+  if (!fs::exists(baseline_path)) { return std::nullopt; }
+  std::ifstream baseline_file(baseline_path);
+  const auto baseline = nlohmann::json::parse(baseline_file, nullptr, false);
+  if (baseline.is_discarded() || !baseline.contains("profit")) {
+    return std::nullopt;
+  }
+  return baseline;
+}
+
+/**
+ * @brief Re-solves an instance and gathers its measures with the baseline.
+ *
+ * @param instance_path The path to the instance file.
+ * @param baseline The reference output.
+ * @param solver_config The parameters of the solver.
+ */
+RegressionResult solveInstance(
+  const fs::path &instance_path, const nlohmann::json &baseline,
+  const emir::SolverConfig &solver_config
+) {
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver solver(
+    createFromFile<emir::OpsInput>(instance_path), solver_config
+  );
+  solver.addLog(log_sink.getStream());
+  solver.solve();
+  const auto &output = solver.getOutput();
+  return {
+    .instance = instance_path.filename().string(),
+    .profit =
+      {.current = output.getTotalProfit(),
+       .baseline = baseline["profit"].get<long>()},
+    .time_elapsed =
+      {.current = output.getTimeSpent(),
+       .baseline = baseline.value("time_elapsed", -1L)},
+    .nodes =
+      {.current = output.getNodes(), .baseline = baseline.value("nodes", -1L)},
+    .build_time =
+      {.current = output.getBuildTime(),
+       .baseline = baseline.value("build_time", -1L)},
+  };
+}
+
+}  // namespace
+
+bool checkModelClassRegression(
+  const std::string &model_class, const RegressionConfig &config,
+  std::ostream &report_os
+) {
+  const auto input_folder = std::format("data/{}/instances", model_class);
+  const auto baseline_folder = std::format("data/{}/outputs/", model_class);
+  std::vector<fs::path> instances;
+  for (const auto &file : fs::directory_iterator(input_folder)) {
+    instances.push_back(file.path());
+  }
+  std::ranges::sort(instances);
+  auto solver_config = config.solver_config;
+  if (config.class_formulation) {
+    solver_config.formulation = getClassFormulation(model_class);
+  }
+
+  report_os << std::format(
+    "{:<24} {:<18} {:<28} {:<28} {:<28} {}\n", "Instance", "Profit",
+    "Time (ms)", "Nodes", "Build time (ms)", "Status"
+  );
+  bool passed = true;
+  for (const auto &instance_path : instances) {
+    const auto baseline =
+      readBaseline(baseline_folder + instance_path.filename().string());
+    if (!baseline) {
+      passed = false;
+      report_os << std::format(
+        "{:<24} {:<18} {:<28} {:<28} {:<28} {}\n",
+        instance_path.filename().string(), "n/a", "n/a", "n/a", "n/a",
+        "FAILED: missing baseline"
+      );
+      continue;
+    }
+    const auto result = solveInstance(instance_path, *baseline, solver_config);
+    std::vector<std::string> failures;
+    if (result.profit.current != result.profit.baseline) {
+      failures.emplace_back("profit");
+    }
+    if (isSlower(
+          result.time_elapsed, config.max_slowdown, kMinTimeDifference
+        )) {
+      failures.emplace_back("time");
+    }
+    if (isSlower(result.nodes, config.max_slowdown, kMinNodesDifference)) {
+      failures.emplace_back("nodes");
+    }
+    if (isSlower(result.build_time, config.max_slowdown, kMinTimeDifference)) {
+      failures.emplace_back("build time");
+    }
+    std::string status = "OK";
+    if (!failures.empty()) {
+      passed = false;
+      status = "FAILED:";
+      for (const auto &failure : failures) { status += " " + failure; }
+    }
+    report_os << std::format(
+      "{:<24} {:<18} {:<28} {:<28} {:<28} {}\n", result.instance,
+      std::format("{} -> {}", result.profit.baseline, result.profit.current),
+      formatMeasure(result.time_elapsed), formatMeasure(result.nodes),
+      formatMeasure(result.build_time), status
+    );
+  }
+  return passed;
+}
\ No newline at end of file
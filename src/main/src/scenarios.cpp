@@ -0,0 +1,332 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file scenarios.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the scenario mode.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <functions.hpp>
+#include <log_sink.hpp>
+#include <memory.hpp>
+#include <ops_cplex_solver.hpp>
+#include <ops_error.hpp>
+#include <ops_input.hpp>
+#include <scenarios.hpp>
+#include <trace.hpp>
+
+namespace {
+
+/** @brief A priority vector to solve the instance with. */
+struct Scenario {
+  // The name used in the report.
+  std::string name;
+  // The profit of each object, including the origin and ending objects.
+  std::vector<int> priorities;
+};
+
+/** @brief The plan found for a scenario. */
+struct ScenarioResult {
+  // Whether a plan was found.
+  bool solved = false;
+  // The profit of the plan.
+  double profit = 0;
+  // The time spent in the search (in milliseconds).
+  long time_spent = -1;
+  // The amount of branch and bound nodes explored.
+  long nodes = 0;
+  // The value of every variable of the model in the plan.
+  std::vector<double> values;
+  // The reason the scenario could not be solved, empty if it did not fail.
+  std::string error;
+};
+
+/**
+ * @brief Reads the scenarios file.
+ *
+ * @param file_path The path to the scenarios file.
+ * @param amount_of_objects The amount of objects of the instance.
+ * @throw OpsError If a scenario does not have a priority per object.
+ */
+std::vector<Scenario> readScenarios(
+  const std::string &file_path, const std::size_t amount_of_objects
+) {
+  std::ifstream scenarios_file(file_path);
+  const auto json = nlohmann::json::parse(scenarios_file);
+  std::vector<Scenario> scenarios;
+  for (const auto &json_scenario : json) {
+    const bool is_object = json_scenario.is_object();
+    Scenario scenario {
+      .name = is_object ? json_scenario.value(
+                            "name", std::format("{}", scenarios.size())
+                          )
+                        : std::format("{}", scenarios.size()),
+      .priorities = (is_object ? json_scenario.at("b") : json_scenario)
+                      .get<std::vector<int>>()
+    };
+    if (scenario.priorities.size() != amount_of_objects) {
+      throw emir::OpsError(
+        "The scenario '{}' has {} priorities instead of {}", scenario.name,
+        scenario.priorities.size(), amount_of_objects
+      );
+    }
+    scenarios.push_back(std::move(scenario));
+  }
+  return scenarios;
+}
+
+/**
+ * @brief Gets the profit of a plan under some priorities.
+ *
+ * @param values The value of every variable of the model in the plan, the
+ * first ones are the y variables.
+ * @param priorities The profit of each object.
+ */
+double getPlanProfit(
+  const std::vector<double> &values, const std::vector<int> &priorities
+) {
+  double profit = 0;
+  for (std::size_t node_idx = 1; node_idx < priorities.size() - 1;
+       ++node_idx) {
+    profit += std::round(values[node_idx - 1]) * priorities[node_idx];
+  }
+  return profit;
+}
+
+/** @brief Solves the scenarios of an instance with several workers. */
+class ScenarioRunner {
+ public:
+  /**
+   * @brief Creates the runner.
+   *
+   * @param input The input of the instance, with its graphs already built.
+   * @param scenarios The scenarios to solve.
+   * @param config The configuration of the solvers.
+   * @param environments The pool the environments are leased from.
+   */
+  ScenarioRunner(
+    const emir::OpsInput &input, const std::vector<Scenario> &scenarios,
+    const emir::SolverConfig &config, emir::CplexEnvironmentPool &environments
+  ) :
+    input_ {input}, scenarios_ {scenarios}, config_ {config},
+    environments_ {environments}, results_(scenarios.size()) {}
+
+  /**
+   * @brief Solves every scenario.
+   *
+   * @param workers The amount of scenarios solved at once.
+   * @return The result of each scenario.
+   */
+  std::vector<ScenarioResult> run(const std::size_t workers) {
+    MemoryProfile::setConcurrent(workers > 1);
+    std::vector<std::thread> threads;
+    for (std::size_t idx = 0; idx < workers; ++idx) {
+      threads.emplace_back([this, idx] {
+        OPS_TRACE_THREAD_NAME(std::format("scenario worker {}", idx));
+        workerLoop();
+      });
+    }
+    for (auto &thread : threads) { thread.join(); }
+    MemoryProfile::setConcurrent(false);
+    return std::move(results_);
+  }
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The input of the instance.
+  const emir::OpsInput &input_;
+  // The scenarios to solve.
+  const std::vector<Scenario> &scenarios_;
+  // The configuration of the solvers.
+  const emir::SolverConfig &config_;
+  // The pool the environments are leased from.
+  emir::CplexEnvironmentPool &environments_;
+  // The result of each scenario.
+  std::vector<ScenarioResult> results_;
+  // The index of the next scenario to solve.
+  std::size_t next_scenario_ = 0;
+  // Protects the results and the next scenario.
+  std::mutex mutex_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /** @brief Solves scenarios until there is none left. */
+  void workerLoop() {
+    // Declared before the solver, so the environment is given back after the
+    // solver is destroyed
+    const auto lease = environments_.acquire();
+    DiscardLogSink log_sink;
+    std::unique_ptr<emir::OpsCplexSolver> solver;
+    while (true) {
+      std::optional<std::vector<double>> closest_plan;
+      std::size_t scenario_idx = 0;
+      {
+        const std::lock_guard lock(mutex_);
+        if (next_scenario_ == scenarios_.size()) { return; }
+        scenario_idx = next_scenario_++;
+        closest_plan = getClosestPlan(scenarios_[scenario_idx]);
+      }
+      const auto &scenario = scenarios_[scenario_idx];
+      OPS_TRACE_SPAN(std::format("scenario {}", scenario.name));
+      ScenarioResult result;
+      try {
+        result = solveScenario(
+          solver, scenario, closest_plan, lease.getEnvironment(),
+          log_sink.getStream()
+        );
+      } catch (const std::exception &exception) {
+        result.error = exception.what();
+      } catch (const IloException &exception) {
+        result.error = exception.getMessage();
+      }
+      // The model may be left half updated, so the next scenario builds its own
+      if (!result.error.empty()) { solver.reset(); }
+      const std::lock_guard lock(mutex_);
+      results_[scenario_idx] = std::move(result);
+    }
+  }
+
+  /**
+   * @brief Solves a scenario, reusing the model of the previous one when the
+   * worker has already built it.
+   *
+   * @param solver The solver of the worker, built if it is null.
+   * @param scenario The scenario to solve.
+   * @param closest_plan The plan given to CPLEX as a start, if any.
+   * @param environment The environment where the model is built.
+   * @param log_os The outflow where the log of CPLEX is written.
+   * @return The plan found, unsolved if there is none.
+   */
+  ScenarioResult solveScenario(
+    std::unique_ptr<emir::OpsCplexSolver> &solver, const Scenario &scenario,
+    const std::optional<std::vector<double>> &closest_plan,
+    const IloEnv &environment, std::ostream &log_os
+  ) const {
+    if (solver) {
+      solver->updatePriorities(scenario.priorities);
+    } else {
+      auto input = input_;
+      input.setPriorities(scenario.priorities);
+      solver = std::make_unique<emir::OpsCplexSolver>(
+        std::move(input), config_, environment
+      );
+      solver->addLog(log_os);
+    }
+    if (closest_plan) { solver->addMipStart(*closest_plan); }
+    solver->solve();
+    const auto &output = solver->getOutput();
+    if (output.getTimeSpent() < 0) { return {}; }
+    return {
+      .solved = true,
+      .profit = solver->getProfit(),
+      .time_spent = output.getTimeSpent(),
+      .nodes = output.getNodes(),
+      .values = solver->getSolutionValues(),
+      .error = {}
+    };
+  }
+
+  /**
+   * @brief Gets the plan of the solved scenario whose priorities are the
+   * closest (in L1 distance) to the given ones. The mutex must be held.
+   *
+   * @param scenario The scenario about to be solved.
+   * @return The plan, or nothing if no scenario has been solved yet.
+   */
+  std::optional<std::vector<double>> getClosestPlan(const Scenario &scenario) {
+    std::optional<std::size_t> closest_idx;
+    long closest_distance = std::numeric_limits<long>::max();
+    for (std::size_t idx = 0; idx < results_.size(); ++idx) {
+      if (!results_[idx].solved) { continue; }
+      long distance = 0;
+      for (std::size_t node_idx = 0; node_idx < scenario.priorities.size();
+           ++node_idx) {
+        distance += std::abs(
+          scenario.priorities[node_idx] - scenarios_[idx].priorities[node_idx]
+        );
+      }
+      if (distance < closest_distance) {
+        closest_distance = distance;
+        closest_idx = idx;
+      }
+    }
+    if (!closest_idx) { return std::nullopt; }
+    return results_[*closest_idx].values;
+  }
+};
+
+}  // namespace
+
+void runScenarios(
+  const ScenarioConfig &config, emir::CplexEnvironmentPool &environments
+) {
+  OPS_TRACE_SPAN("scenarios");
+  const auto input = createFromFile<emir::OpsInput>(config.instance_path);
+  const auto scenarios =
+    readScenarios(config.scenarios_path, input.getAmountOfObjects());
+  const auto results =
+    ScenarioRunner(input, scenarios, config.solver_config, environments)
+      .run((std::size_t)config.workers);
+
+  nlohmann::json report {
+    {"scenarios", nlohmann::json::array()},
+    {"profit_matrix", nlohmann::json::array()}
+  };
+  for (std::size_t row = 0; row < scenarios.size(); ++row) {
+    const auto &result = results[row];
+    report["scenarios"].push_back({
+      {"name", scenarios[row].name},
+      {"profit", result.solved ? nlohmann::json(result.profit) : nullptr},
+      {"time_elapsed", result.time_spent},
+      {"nodes", result.nodes},
+    });
+    if (!result.error.empty()) {
+      report["scenarios"].back()["error"] = result.error;
+    }
+    auto profits = nlohmann::json::array();
+    for (const auto &scenario : scenarios) {
+      profits.push_back(
+        result.solved
+          ? nlohmann::json(getPlanProfit(result.values, scenario.priorities))
+          : nullptr
+      );
+    }
+    report["profit_matrix"].push_back(std::move(profits));
+  }
+  std::ofstream output_file(config.output_path);
+  output_file << report.dump(2) << '\n';
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file triage.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the triage mode.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <functions.hpp>
+#include <ops_cplex_solver.hpp>
+#include <ops_input.hpp>
+#include <plan.hpp>
+#include <triage.hpp>
+
+namespace {
+
+// Relative gap under which an instance is easy, the greedy plan is almost
+// optimal.
+constexpr double kEasyGap = 0.01;
+// Relative gap over which an instance is hard. Under it the greedy plan is
+// close enough for reduced-cost fixing to remove columns.
+constexpr double kHardGap = 0.1;
+// Amount of columns over which the model is too big to solve at once.
+constexpr long kMaxColumns = 200000;
+// Windows of the rolling horizon recommended for the models too big.
+constexpr int kRollingHorizonWindows = 4;
+// Nodes between two runs of the rounding heuristic recommended for the hard
+// instances.
+constexpr int kHeuristicFrequency = 20;
+
+/**
+ * @brief Bounds the profit of an instance and recommends how to solve it.
+ *
+ * @param instance_path The path to the instance file.
+ * @param solver_config The configuration the model is built with.
+ */
+nlohmann::json triageInstance(
+  const std::string &instance_path, const emir::SolverConfig &solver_config
+) {
+  const auto start_time = std::chrono::steady_clock::now();
+  const auto input = createFromFile<emir::OpsInput>(instance_path);
+  const auto greedy_values =
+    emir::toValues(input, emir::buildGreedyPlan(input));
+  const double lower_bound = emir::getPlanProfit(input, greedy_values);
+  const double knapsack_bound = getKnapsackBound(input);
+  const emir::OpsCplexSolver solver(emir::OpsInput(input), solver_config);
+  const double relaxation_bound = solver.getRelaxationBound();
+  const double upper_bound = std::min(relaxation_bound, knapsack_bound);
+  const double gap =
+    upper_bound > 0 ? std::max(upper_bound - lower_bound, 0.0) / upper_bound
+                    : 0.0;
+  const long columns = solver.getAmountOfColumns();
+  const bool is_too_big = columns > kMaxColumns;
+  const bool is_hard = gap > kHardGap;
+  const auto *hardness = gap <= kEasyGap ? "easy" : is_hard ? "hard" : "medium";
+  return {
+    {"instance", instance_path},
+    {"lower_bound", lower_bound},
+    {"upper_bound", upper_bound},
+    {"relaxation_bound", relaxation_bound},
+    {"knapsack_bound", knapsack_bound},
+    {"gap", gap},
+    {"hardness", hardness},
+    {"objects", input.getAmountOfObjects()},
+    {"sliding_bars", input.getAmountOfSlidingBars()},
+    {"rows", solver.getAmountOfRows()},
+    {"columns", columns},
+    {"recommendation",
+     {{"solver", "cplex"},
+      {"formulation", emir::toString(solver.getFormulation())},
+      {"rolling_horizon", is_too_big ? kRollingHorizonWindows : 0},
+      {"reduced_cost_fixing", gap <= kHardGap},
+      {"branching",
+       emir::toString(
+         is_hard ? emir::Branching::kAggregates : emir::Branching::kCplex
+       )},
+      {"heuristic_frequency", is_hard ? kHeuristicFrequency : 0}}},
+    {"time_elapsed",
+     std::chrono::duration_cast<std::chrono::milliseconds>(
+       std::chrono::steady_clock::now() - start_time
+     )
+       .count()}
+  };
+}
+
+}  // namespace
+
+double getKnapsackBound(const emir::OpsInput &input) {
+  const auto amount_of_objects = input.getAmountOfObjects();
+  const auto last_node_id = (unsigned int)amount_of_objects - 1;
+  std::vector<int> amount_of_sliding_bars(amount_of_objects, 0);
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &object_id : input.getObjectsPerSlidingBar(k)) {
+      ++amount_of_sliding_bars[object_id];
+    }
+  }
+  double bound = 0;
+  // No sliding bar limits the objects that none of them can observe
+  for (unsigned int object_id = 1; object_id < last_node_id; ++object_id) {
+    if (amount_of_sliding_bars[object_id] == 0) {
+      bound += input.getPriority(object_id);
+    }
+  }
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto &graph = input.getGraph(k);
+    const auto &objects = input.getObjectsPerSlidingBar(k);
+    std::vector<long> weights(
+      amount_of_objects, std::numeric_limits<long>::max()
+    );
+    long min_time_to_end = input.getTimeLimit();
+    for (const auto &arc : graph.getArcs()) {
+      const auto origin_id = arc.getOriginId();
+      const auto destination_id = arc.getDestinationId();
+      const long time = input.getTimeToProcess({origin_id, destination_id});
+      if (destination_id == last_node_id) {
+        min_time_to_end = std::min(min_time_to_end, time);
+      } else {
+        weights[destination_id] = std::min(weights[destination_id], time);
+      }
+    }
+    const auto get_profit = [&](const unsigned int object_id) {
+      return input.getPriority(object_id) /
+             (double)amount_of_sliding_bars[object_id];
+    };
+    std::vector<unsigned int> order(objects.begin(), objects.end());
+    // Most profit per unit of time first, the free objects before any other
+    std::ranges::sort(
+      order,
+      [&](const unsigned int first, const unsigned int second) {
+        return get_profit(first) * (double)std::max(weights[second], 0L) >
+               get_profit(second) * (double)std::max(weights[first], 0L);
+      }
+    );
+    double capacity = (double)(input.getTimeLimit() - min_time_to_end);
+    for (const auto &object_id : order) {
+      const auto weight = (double)std::max(weights[object_id], 0L);
+      if (weight <= capacity) {
+        bound += get_profit(object_id);
+        capacity -= weight;
+      } else {
+        bound += get_profit(object_id) * std::max(capacity, 0.0) / weight;
+        break;
+      }
+    }
+  }
+  return bound;
+}
+
+void runTriage(
+  const std::vector<std::string> &instance_paths,
+  const emir::SolverConfig &solver_config, std::ostream &output_os
+) {
+  auto reports = nlohmann::json::array();
+  for (const auto &instance_path : instance_paths) {
+    reports.push_back(triageInstance(instance_path, solver_config));
+  }
+  output_os << reports.dump(2) << '\n';
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file aggregate_branching_handler.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a handler that branches on the
+ * amount of objects observed by each sliding bar.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_AGGREGATE_BRANCHING_HANDLER_HPP_
+#define EMIR_AGGREGATE_BRANCHING_HANDLER_HPP_
+
+#include <vector>
+
+#include <ilcplex/ilocplex.h>
+
+#include <ops_input.hpp>
+#include <solver_callback.hpp>
+
+namespace emir {
+
+/**
+ * @brief Branches on the amount of objects observed by a sliding bar when it
+ * is fractional in the relaxation of a node: one child observes at most its
+ * floor and the other at least its ceiling. A single object rarely moves the
+ * bound, while the amount decides how the time of the sliding bar is spent.
+ * The sliding bar most fractional is chosen, and CPLEX branches on its own
+ * when every amount is integral. The data is only read during the search, so
+ * CPLEX can invoke the handler from all its threads at once.
+ */
+class AggregateBranchingHandler : public CallbackHandler {
+ public:
+  /**
+   * @brief Keeps the objects each sliding bar can observe.
+   *
+   * @param input The input of the model.
+   * @param observed_objects The variables that tell if each object is
+   * observed (from the second object to the second last).
+   */
+  AggregateBranchingHandler(
+    const OpsInput &input, const IloNumVarArray &observed_objects
+  );
+
+  /** @brief Invoked in the branching context. */
+  [[nodiscard]] CPXLONG getContextMask() const override {
+    return IloCplex::Callback::Context::Id::Branching;
+  }
+
+  /**
+   * @brief Creates the two branches of the most fractional sliding bar, if
+   * any.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The minimum distance of an amount to an integer to branch on it.
+  static constexpr double kMinFractionality = 1e-4;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The variables that tell if each object is observed.
+  IloNumVarArray observed_objects_;
+  // The objects each sliding bar can observe.
+  std::vector<std::vector<unsigned int>> objects_per_sliding_bar_;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_AGGREGATE_BRANCHING_HANDLER_HPP_
\ No newline at end of file
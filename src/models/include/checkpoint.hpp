@@ -0,0 +1,69 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file checkpoint.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the checkpoints written during
+ * long solves, so a solve interrupted can be resumed from its incumbent.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_CHECKPOINT_HPP_
+#define EMIR_CHECKPOINT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace emir {
+
+/** @brief The state of a solve at some moment of the search. */
+struct Checkpoint {
+  // Hash of the content of the instance being solved.
+  std::uint64_t instance_hash;
+  // The time spent solving so far (in milliseconds).
+  long elapsed_time;
+  // Objective value of the incumbent (NaN if there is none).
+  double incumbent;
+  // Best bound of the objective value (NaN if unknown).
+  double bound;
+  // Value of every variable of the model in the incumbent, empty if there is
+  // no incumbent.
+  std::vector<double> values;
+};
+
+/**
+ * @brief Reads a checkpoint written by writeCheckpoint.
+ *
+ * @param file_path The path to the checkpoint file.
+ * @throw OpsError If the file cannot be read or is malformed.
+ */
+Checkpoint readCheckpoint(const std::string &file_path);
+
+/**
+ * @brief Writes a checkpoint as JSON. The file is replaced atomically, so an
+ * interruption while writing keeps the previous checkpoint.
+ *
+ * @param checkpoint The checkpoint to write.
+ * @param file_path The path to the checkpoint file.
+ */
+void writeCheckpoint(const Checkpoint &checkpoint, const std::string &file_path);
+
+}  // namespace emir
+
+#endif  // EMIR_CHECKPOINT_HPP_
\ No newline at end of file
@@ -0,0 +1,98 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file checkpoint_handler.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the callback handler that writes
+ * checkpoints periodically during the search.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_CHECKPOINT_HANDLER_HPP_
+#define EMIR_CHECKPOINT_HANDLER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <ilcplex/ilocplex.h>
+
+#include <solver_callback.hpp>
+
+namespace emir {
+
+/**
+ * @brief Writes the incumbent and the best bound to a checkpoint file every
+ * given interval.
+ */
+class CheckpointHandler : public CallbackHandler {
+ public:
+  /**
+   * @brief Creates the handler, starting to count the time of the search.
+   *
+   * @param file_path The path to the checkpoint file.
+   * @param interval The minimum time between two checkpoints.
+   * @param variables Every variable of the model, in the order they are
+   * stored in the checkpoint.
+   * @param instance_hash Hash of the content of the instance being solved.
+   * @param elapsed_time The time spent in previous runs of the same solve (in
+   * milliseconds).
+   */
+  CheckpointHandler(
+    std::string file_path, std::chrono::seconds interval,
+    const IloNumVarArray &variables, std::uint64_t instance_hash,
+    long elapsed_time
+  );
+
+  /** @brief Invoked in the global progress context. */
+  [[nodiscard]] CPXLONG getContextMask() const override {
+    return IloCplex::Callback::Context::Id::GlobalProgress;
+  }
+
+  /**
+   * @brief Writes a checkpoint if the interval has passed since the last one.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The path to the checkpoint file.
+  std::string file_path_;
+  // The minimum time between two checkpoints.
+  std::chrono::seconds interval_;
+  // Every variable of the model.
+  IloNumVarArray variables_;
+  // Hash of the content of the instance being solved.
+  std::uint64_t instance_hash_;
+  // The time spent in previous runs of the same solve (in milliseconds).
+  long elapsed_time_;
+  // The moment the search started.
+  std::chrono::steady_clock::time_point start_;
+  // The moment the last checkpoint was written.
+  std::chrono::steady_clock::time_point last_write_;
+  // Allows only one thread to write the checkpoint.
+  std::mutex mutex_;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_CHECKPOINT_HANDLER_HPP_
\ No newline at end of file
@@ -0,0 +1,148 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file cplex_environment_pool.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a pool of CPLEX environments,
+ * so several instances can be solved without creating and ending an
+ * environment for each one of them.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_CPLEX_ENVIRONMENT_POOL_HPP_
+#define EMIR_CPLEX_ENVIRONMENT_POOL_HPP_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <ilcplex/ilocplex.h>
+
+namespace emir {
+
+/**
+ * @brief Keeps the CPLEX environments that are not being used, lending them
+ * to the solvers. The environments are created on demand, so the pool has as
+ * many as solvers running at once.
+ */
+class CplexEnvironmentPool {
+ public:
+  /**
+   * @brief An environment lent by the pool, which is given back when the
+   * lease is destroyed. The solvers using it must be destroyed before.
+   */
+  class Lease {
+   public:
+    /** @brief Gives the environment back to the pool. */
+    ~Lease();
+
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    Lease &operator=(Lease &&) = delete;
+
+    /**
+     * @brief Takes the environment from another lease.
+     *
+     * @param other The lease that will not give the environment back.
+     */
+    Lease(Lease &&other) noexcept;
+
+    /** @brief Gets the environment lent. */
+    [[nodiscard]] const IloEnv &getEnvironment() const {
+      return environment_;
+    }
+
+   private:
+    friend class CplexEnvironmentPool;
+
+    // The pool the environment belongs to, null if it was moved.
+    CplexEnvironmentPool *pool_;
+    // The environment lent.
+    IloEnv environment_;
+    // The amount of times the environment has been lent.
+    std::size_t uses_;
+
+    /**
+     * @brief Lends an environment of the pool.
+     *
+     * @param pool The pool the environment belongs to.
+     * @param environment The environment lent.
+     * @param uses The amount of times the environment has been lent.
+     */
+    Lease(CplexEnvironmentPool *pool, IloEnv environment, std::size_t uses);
+  };
+
+  /** @brief Creates an empty pool. */
+  CplexEnvironmentPool() = default;
+
+  /** @brief Ends every environment of the pool. */
+  ~CplexEnvironmentPool();
+
+  CplexEnvironmentPool(const CplexEnvironmentPool &) = delete;
+  CplexEnvironmentPool(CplexEnvironmentPool &&) = delete;
+  CplexEnvironmentPool &operator=(const CplexEnvironmentPool &) = delete;
+  CplexEnvironmentPool &operator=(CplexEnvironmentPool &&) = delete;
+
+  /**
+   * @brief Lends an idle environment, creating one if there is none.
+   * Can be called from several threads.
+   */
+  [[nodiscard]] Lease acquire();
+
+  /** @brief Gets the amount of environments created by the pool. */
+  [[nodiscard]] std::size_t getCreatedEnvironments() const;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The times an environment is lent before replacing it, so the memory kept
+  // by Concert for the objects already ended does not pile up.
+  static constexpr std::size_t kMaxUses = 64;
+
+  /** @brief An environment waiting to be lent. */
+  struct IdleEnvironment {
+    // The environment.
+    IloEnv environment;
+    // The amount of times it has been lent.
+    std::size_t uses;
+  };
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The environments waiting to be lent.
+  std::vector<IdleEnvironment> idle_environments_;
+  // The amount of environments created.
+  std::size_t created_environments_ = 0;
+  // Protects the idle environments and the counter.
+  mutable std::mutex mutex_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Keeps an environment given back by a lease, or ends it if it has
+   * been lent too many times.
+   *
+   * @param environment The environment given back.
+   * @param uses The amount of times it has been lent.
+   */
+  void release(IloEnv environment, std::size_t uses);
+};
+
+}  // namespace emir
+
+#endif  // EMIR_CPLEX_ENVIRONMENT_POOL_HPP_
\ No newline at end of file
@@ -0,0 +1,148 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file cut_separation_handler.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a handler that separates cover
+ * and clique cuts on the observed objects from the relaxation of each node.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_CUT_SEPARATION_HANDLER_HPP_
+#define EMIR_CUT_SEPARATION_HANDLER_HPP_
+
+#include <vector>
+
+#include <ilcplex/ilocplex.h>
+
+#include <ops_input.hpp>
+#include <solver_callback.hpp>
+
+namespace emir {
+
+/**
+ * @brief Separates user cuts on the observed objects (y) that the relaxation
+ * ignores:
+ * - Cover cuts of the time limit of each sliding bar, since visiting an
+ *   object takes at least the shortest arc entering it.
+ * - Clique cuts among objects that cannot be observed together, because a
+ *   sliding bar that can observe both of them has no time to visit them.
+ * The data is computed once and only read during the search, so CPLEX can
+ * invoke the handler from all its threads at once.
+ */
+class CutSeparationHandler : public CallbackHandler {
+ public:
+  /**
+   * @brief Computes the time limit of each sliding bar and the objects that
+   * cannot be observed together.
+   *
+   * @param input The input of the model.
+   * @param observed_objects The variables that tell if each object is
+   * observed (from the second object to the second last).
+   */
+  CutSeparationHandler(
+    const OpsInput &input, const IloNumVarArray &observed_objects
+  );
+
+  /** @brief Invoked in the relaxation context. */
+  [[nodiscard]] CPXLONG getContextMask() const override {
+    return IloCplex::Callback::Context::Id::Relaxation;
+  }
+
+  /**
+   * @brief Adds the cuts violated by the relaxation of the node.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+
+ private:
+  /** @brief The time limit of a sliding bar, as a knapsack on its objects. */
+  struct Knapsack {
+    // The objects of the sliding bar that take some time to visit.
+    std::vector<unsigned int> objects;
+    // The minimum time spent to reach each object.
+    std::vector<int> weights;
+    // The time available for the objects, after reaching the last one.
+    int capacity;
+  };
+
+  // --------------------------- Static Constants -------------------------- //
+
+  // The minimum violation of a cut to be added.
+  static constexpr double kMinViolation = 1e-4;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The variables that tell if each object is observed.
+  IloNumVarArray observed_objects_;
+  // The knapsack of each sliding bar that has a cover.
+  std::vector<Knapsack> knapsacks_;
+  // Whether two objects cannot be observed together (by object id).
+  std::vector<std::vector<bool>> are_incompatible_;
+  // Whether an object cannot be observed at all (by object id).
+  std::vector<bool> is_unreachable_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Computes the knapsack of a sliding bar and the objects it cannot
+   * observe together.
+   *
+   * @param input The input of the model.
+   * @param sliding_bar_idx The index of the sliding bar.
+   */
+  void addSlidingBar(const OpsInput &input, int sliding_bar_idx);
+
+  /**
+   * @brief Adds the extended cover cut of each knapsack that is violated.
+   *
+   * @param context The context where the callback was invoked.
+   * @param values The value of each observed object in the relaxation.
+   */
+  void addCoverCuts(
+    const IloCplex::Callback::Context &context, const IloNumArray &values
+  ) const;
+
+  /**
+   * @brief Adds the clique cuts violated, growing a clique greedily from each
+   * object observed in the relaxation.
+   *
+   * @param context The context where the callback was invoked.
+   * @param values The value of each observed object in the relaxation.
+   */
+  void addCliqueCuts(
+    const IloCplex::Callback::Context &context, const IloNumArray &values
+  ) const;
+
+  /**
+   * @brief Adds the cut that at most some amount of objects are observed.
+   *
+   * @param context The context where the callback was invoked.
+   * @param objects The objects of the cut.
+   * @param max_observed The maximum amount of them observed.
+   */
+  void addCut(
+    const IloCplex::Callback::Context &context,
+    const std::vector<unsigned int> &objects, int max_observed
+  ) const;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_CUT_SEPARATION_HANDLER_HPP_
\ No newline at end of file
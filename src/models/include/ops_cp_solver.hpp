@@ -0,0 +1,162 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file ops_cp_solver.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the solver that uses CP
+ * Optimizer to solve the O.P.S. problem.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_OPS_CP_SOLVER_HPP_
+#define EMIR_OPS_CP_SOLVER_HPP_
+
+#include <ostream>
+#include <vector>
+
+#include <ilcp/cp.h>
+
+#include <ops_solver.hpp>
+#include <solver_config.hpp>
+
+namespace emir {
+
+/**
+ * @brief Solves the O.P.S. problem with CP Optimizer. Each sliding bar is a
+ * sequence of optional intervals (one per node it can visit) whose transition
+ * distances are the times of T, so the order and times are propagated
+ * directly instead of through big-M rows. Every sliding bar that can observe
+ * an object is synchronized with an interval shared by all of them, whose
+ * presence is the profit of the object.
+ */
+class OpsCpSolver : public OpsSolver {
+ public:
+  /**
+   * @brief Moves the input and builds the model with the given parameters.
+   * Only the tolerance, time limit and threads of the configuration are used.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param config The parameters of the solver.
+   */
+  OpsCpSolver(OpsInput &&input, const SolverConfig &config);
+
+  /**
+   * @brief Moves the input and builds the model in an environment owned by the
+   * caller, which can be reused by other solvers once this one is destroyed.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param config The parameters of the solver.
+   * @param environment The environment where the model is built.
+   */
+  OpsCpSolver(
+    OpsInput &&input, const SolverConfig &config, const IloEnv &environment
+  );
+
+  OpsCpSolver(const OpsCpSolver &) = delete;
+  OpsCpSolver(OpsCpSolver &&) = delete;
+  OpsCpSolver &operator=(const OpsCpSolver &) = delete;
+  OpsCpSolver &operator=(OpsCpSolver &&) = delete;
+
+  /**
+   * @brief Delete the environment of the solution, or only the objects of the
+   * model if the environment belongs to the caller.
+   */
+  ~OpsCpSolver() override;
+
+  /** @brief Searches the best plan with CP Optimizer. */
+  void solve() override;
+
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Get the profit of the solution. */
+  [[nodiscard]] double getProfit() const {
+    return cp_.getObjValue();
+  }
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Add a log stream to output the log of the search.
+   *
+   * @param log_os The output stream to write the log to.
+   */
+  void addLog(std::ostream &log_os) {
+    cp_.setOut(log_os);
+  }
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // An environment, manage the memory and identifiers for modeling objects.
+  IloEnv environment_;
+  // Whether the environment was created by the solver (and must be ended by
+  // it).
+  bool owns_environment_ = true;
+  // Algorithm used to search the plan.
+  IloCP cp_;
+  // Model with the sequences of the sliding bars.
+  IloModel model_;
+  // The interval where each object is observed, shared by the sliding bars
+  // (from the second object to the second last).
+  IloIntervalVarArray observations_;
+  // The interval of each node visited by each sliding bar, in the order of
+  // the nodes of the sliding bar.
+  std::vector<IloIntervalVarArray> visits_;
+  // The id of each node of each sliding bar: the first one, its objects and
+  // the last one.
+  std::vector<std::vector<unsigned int>> nodes_;
+  // The order of the visits of each sliding bar.
+  std::vector<IloIntervalSequenceVar> routes_;
+  // The time of T between every two nodes.
+  IloTransitionDistance transition_distance_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Sets the parameters and builds the model, recording the time spent.
+   *
+   * @param config The parameters of the solver.
+   */
+  void setUp(const SolverConfig &config);
+
+  /** @brief Adds the intervals of the objects and the objective. */
+  void addObservations();
+
+  /**
+   * @brief Adds the sequence of a sliding bar, starting at the first node at
+   * 0 and ending at the last one before the time limit.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   */
+  void addRoute(int sliding_bar_idx);
+
+  /**
+   * @brief Translates the sequences found into the arcs, objects and times of
+   * the output.
+   *
+   * @param time_elapsed The time spent by the search.
+   */
+  void setSolutionToOutput(long time_elapsed);
+
+  /** @brief Ends the objects of the model, keeping the environment. */
+  void endModel();
+};
+
+}  // namespace emir
+
+#endif  // EMIR_OPS_CP_SOLVER_HPP_
\ No newline at end of file
@@ -26,9 +26,22 @@
 #ifndef EMIR_OPS_CPLEX_SOLVER_HPP_
 #define EMIR_OPS_CPLEX_SOLVER_HPP_
 
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <ilcplex/ilocplex.h>
 
+#include <checkpoint.hpp>
 #include <ops_solver.hpp>
+#include <solver_callback.hpp>
+#include <solver_config.hpp>
+#include <time_expanded_network.hpp>
 
 namespace emir {
 
@@ -54,10 +67,36 @@ class OpsCplexSolver : public OpsSolver {
    */
   OpsCplexSolver(OpsInput &&input, double tolerance);
 
-  /** @brief Default copy constructor. */
-  OpsCplexSolver(const OpsCplexSolver &) = default;
+  /**
+   * @brief Moves the input and builds the model with the given parameters.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param config The parameters of the CPLEX solver.
+   */
+  OpsCplexSolver(OpsInput &&input, const SolverConfig &config);
+
+  /**
+   * @brief Moves the input and builds the model in an environment owned by the
+   * caller, which can be reused by other solvers once this one is destroyed.
+   * Only one solver can use the environment at a time.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param config The parameters of the CPLEX solver.
+   * @param environment The environment where the model is built.
+   */
+  OpsCplexSolver(
+    OpsInput &&input, const SolverConfig &config, const IloEnv &environment
+  );
+
+  OpsCplexSolver(const OpsCplexSolver &) = delete;
+  OpsCplexSolver(OpsCplexSolver &&) = delete;
+  OpsCplexSolver &operator=(const OpsCplexSolver &) = delete;
+  OpsCplexSolver &operator=(OpsCplexSolver &&) = delete;
 
-  /** @brief Delete the environment of the solution. */
+  /**
+   * @brief Delete the environment of the solution, or only the objects of the
+   * model if the environment belongs to the caller.
+   */
   ~OpsCplexSolver() override;
 
   /**
@@ -73,6 +112,40 @@ class OpsCplexSolver : public OpsSolver {
     return cplex_.getObjValue();
   }
 
+  /**
+   * @brief Get the value of every variable of the model (y, s and x) in the
+   * solution, in the order used by addMipStart.
+   */
+  [[nodiscard]] std::vector<double> getSolutionValues() const {
+    return IloNumVarArrayToVector(variables_);
+  }
+
+  /**
+   * @brief Get the formulation of the model, never by size since it is
+   * resolved when the model is built.
+   */
+  [[nodiscard]] Formulation getFormulation() const {
+    return formulation_;
+  }
+
+  /** @brief Get the amount of rows of the extracted model. */
+  [[nodiscard]] long getAmountOfRows() const {
+    return cplex_.getNrows();
+  }
+
+  /** @brief Get the amount of columns of the extracted model. */
+  [[nodiscard]] long getAmountOfColumns() const {
+    return cplex_.getNcols();
+  }
+
+  /**
+   * @brief Solves the linear relaxation of the model (without the cuts of
+   * CPLEX), to compare the bounds of the formulations.
+   *
+   * @return The objective value of the relaxation.
+   */
+  [[nodiscard]] double getRelaxationBound() const;
+
   // -------------------------------- Adders ------------------------------- //
 
   /**
@@ -84,20 +157,154 @@ class OpsCplexSolver : public OpsSolver {
     cplex_.setOut(log_os);
   }
 
- private:
-  // --------------------------- Static Constants --------------------------- //
+  /**
+   * @brief Add a handler to be invoked by CPLEX during the search.
+   *
+   * @param handler The handler to add.
+   */
+  void addCallbackHandler(std::shared_ptr<CallbackHandler> handler) {
+    callback_.addHandler(std::move(handler));
+  }
+
+  /**
+   * @brief Add an aborter, so the search can be stopped from another thread.
+   *
+   * @param aborter The aborter that stops the search.
+   */
+  void addAborter(const IloCplex::Aborter &aborter) {
+    cplex_.use(aborter);
+  }
 
-  // The maximum time to solve the problem (1 hour).
-  static constexpr double kTimeLimit = 3600.0;
+  /**
+   * @brief Add a solution to start the search from, which CPLEX repairs if it
+   * is not feasible.
+   *
+   * @param values The value of every variable of the model, in the order
+   * given by getSolutionValues.
+   * @throw OpsError If the amount of values does not match the model.
+   */
+  void addMipStart(const std::vector<double> &values);
+
+  /**
+   * @brief Changes the priorities of the objects on the extracted model, so
+   * the next solve does not need to build it again. The current solution, if
+   * any, is used as a MIP start of the next solve.
+   *
+   * @param priorities The new profit of each object, including the origin
+   * and ending objects.
+   * @throw OpsError If the amount of priorities does not match the input.
+   */
+  void updatePriorities(const std::vector<int> &priorities);
+
+  /**
+   * @brief Lets a sliding bar observe an object on the extracted model,
+   * adding the arcs it needs (columns, MTZ rows and coefficients in the flow
+   * rows) and its flow rows. The current solution, if any, is used as a MIP
+   * start of the next solve.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   * @param object_id The object to add. It must be an object of the instance,
+   * so its times are known.
+   * @throw OpsError If the sliding bar or the object do not exist.
+   */
+  void addObjectToSlidingBar(int sliding_bar_idx, unsigned int object_id);
+
+  /**
+   * @brief Stops a sliding bar from observing an object on the extracted
+   * model, fixing its arcs to 0 and freeing its flow rows (so it can be added
+   * back cheaply). The current solution, if any, is used as a MIP start of
+   * the next solve.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   * @param object_id The object to remove.
+   * @throw OpsError If the sliding bar or the object do not exist.
+   */
+  void removeObjectFromSlidingBar(int sliding_bar_idx, unsigned int object_id);
+
+  /**
+   * @brief Forces an object to be observed at the given time, fixing that
+   * part of the plan for the next solves.
+   *
+   * @param object_id The object to fix (neither the first nor the last).
+   * @param time The moment the object is observed.
+   * @throw OpsError If the object does not exist.
+   */
+  void fixObject(unsigned int object_id, double time);
+
+  // ------------------------------ Checkpoints ---------------------------- //
+
+  /**
+   * @brief Writes the incumbent and the best bound to a checkpoint file
+   * periodically during the search.
+   *
+   * @param file_path The path to the checkpoint file.
+   * @param interval The minimum time between two checkpoints.
+   */
+  void enableCheckpoints(std::string file_path, std::chrono::seconds interval);
+
+  /**
+   * @brief Continues a solve from a checkpoint: its incumbent is used as a MIP
+   * start and its elapsed time is taken from the time limit and added to the
+   * time spent.
+   *
+   * @param checkpoint The checkpoint of a previous run of the same instance.
+   * @throw OpsError If the checkpoint belongs to another instance.
+   */
+  void resume(const Checkpoint &checkpoint);
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // Version of the formulation. Bump it whenever the variables or the
+  // constraints change, so the models saved in the model cache are rebuilt.
+  static constexpr int kFormulationVersion = 2;
+  // The maximum amount of columns of the time-expanded network, the buckets
+  // are made longer until it fits.
+  static constexpr std::size_t kMaxTimeIndexedColumns = 200000;
+  // Margin below which a relaxation value is taken as a bound, and a bound
+  // as lower than the profit of the greedy plan.
+  static constexpr double kFixingTolerance = 1e-6;
 
   // ------------------------------ Attributes ----------------------------- //
 
   // An environment, manage the memory and identifiers for modeling objects.
   IloEnv environment_;
+  // Whether the environment was created by the solver (and must be ended by
+  // it).
+  bool owns_environment_ = true;
   // Algorithm used to solve the Linear Programming problem.
   IloCplex cplex_;
   // Model that represents the Linear Programming problem.
   IloModel model_;
+  // Objective of the model, kept to change its coefficients.
+  IloObjective objective_;
+  // Generic callback that dispatches to the handlers added.
+  SolverCallback callback_;
+  // The handler that separates the user cuts, null if they are disabled.
+  std::shared_ptr<CallbackHandler> cut_handler_;
+  // The handler that branches on the aggregates of the sliding bars, null if
+  // it is disabled.
+  std::shared_ptr<CallbackHandler> branching_handler_;
+  // The path to the checkpoint file, empty if they are disabled.
+  std::string checkpoint_path_;
+  // The minimum time between two checkpoints.
+  std::chrono::seconds checkpoint_interval_ {0};
+  // The time spent in previous runs of the solve (in milliseconds).
+  long resumed_time_ = 0;
+  // Whether the rows of the nested sliding bars are added to the model.
+  bool symmetry_breaking_ = true;
+  // How the times of the objects are modeled (never by size, it is resolved
+  // when the model is built).
+  Formulation formulation_ = Formulation::kMtz;
+  // The network of the time-indexed formulation, empty with the others.
+  std::optional<TimeExpandedNetwork> time_network_;
+  // Whether the columns that cannot improve the greedy plan are fixed before
+  // the model is extracted.
+  bool reduced_cost_fixing_ = false;
+  // How CPLEX chooses the variables to branch on.
+  Branching branching_ = Branching::kCplex;
+  // The columns fixed before the model was extracted, freed when it changes.
+  std::vector<IloNumVar> presolve_fixings_;
 
   // --------------------------- Model Attributes -------------------------- //
 
@@ -110,9 +317,168 @@ class OpsCplexSolver : public OpsSolver {
   // Float vector that stores how much time has passed since the beginning of
   // the observation to the moment the object is observed.
   IloNumVarArray time_at_objects_;
+  // Every variable of the model (y, s and x), in the order used by the
+  // checkpoints.
+  IloNumVarArray variables_;
+  // Float vector with the time each arc leaves its origin, 0 if it is not
+  // used (only in the time-flow formulation).
+  IloNumVarArray time_flows_;
+  // Float vector with the columns of the time-expanded network, numbered as
+  // described in TimeExpandedNetwork (only in the time-indexed formulation).
+  IloNumVarArray time_buckets_;
+  // Flow rows leaving each node of each sliding bar (by node id).
+  std::vector<std::map<unsigned int, IloRange>> delta_plus_constraints_;
+  // Flow rows entering each node of each sliding bar (by node id).
+  std::vector<std::map<unsigned int, IloRange>> delta_minus_constraints_;
+  // Rows that tie the arcs of nested sliding bars, by each of both bars.
+  std::multimap<int, IloRange> symmetry_constraints_;
 
   // --------------------------- Private Methods ---------------------------- //
 
+  /**
+   * @brief Sets the parameters and builds the model, recording the time spent.
+   *
+   * @param config The parameters of the CPLEX solver.
+   */
+  void setUp(const SolverConfig &config);
+
+  /**
+   * @brief Sets the formulation of the model. By size, the time-indexed one is
+   * chosen if its network fits in buckets that are not longer than the
+   * shortest arc (longer buckets let the sliding bars go through several
+   * objects in the same bucket, so the network hardly cuts anything off).
+   *
+   * @param config The parameters of the CPLEX solver.
+   */
+  void chooseFormulation(const SolverConfig &config);
+
+  /**
+   * @brief Makes the model (or loads it from the model cache) and extracts it
+   * into the CPLEX algorithm, recording the memory used by each phase. With
+   * reduced-cost fixing the columns are fixed before the extraction, and the
+   * model is not saved to the cache.
+   *
+   * @param model_cache The directory of the model cache, empty if disabled.
+   */
+  void buildModel(const std::string &model_cache);
+
+  /**
+   * @brief Fixes the columns that cannot be part of a plan better than the
+   * greedy one (see buildGreedyPlan): the objects and arcs the sliding bars
+   * cannot reach in time, and the binary columns at a bound of the relaxation
+   * whose reduced cost would take its objective below the greedy profit.
+   * Only the bounds change, the rows left empty are removed by CPLEX.
+   *
+   * @return The value of every variable of the greedy plan, to be added as a
+   * MIP start once the model is extracted.
+   */
+  std::vector<double> presolveModel();
+
+  /**
+   * @brief Frees the columns fixed by presolveModel, since the greedy plan and
+   * the reduced costs no longer bound a model that changes.
+   */
+  void releasePresolveFixings();
+
+  /**
+   * @brief Solves the linear relaxation of a copy of the model, so the one
+   * extracted keeps its integer variables.
+   *
+   * @param variables The variables whose values are read.
+   * @param values Receives the value of each variable.
+   * @param reduced_costs Receives the reduced cost of each variable.
+   * @return The objective value of the relaxation, empty if it has none.
+   */
+  std::optional<double> solveRelaxation(
+    const IloNumVarArray &variables, IloNumArray &values,
+    IloNumArray &reduced_costs
+  ) const;
+
+  /**
+   * @brief Loads the model saved by exportModel, assigning its columns to the
+   * y, s and x variables.
+   *
+   * @param file_path The path to the saved model.
+   * @throw OpsError If the model saved does not match the input.
+   */
+  void importModel(const std::string &file_path);
+
+  /**
+   * @brief Saves the extracted model, replacing the file atomically.
+   *
+   * @param file_path The path where the model is saved.
+   */
+  void exportModel(const std::string &file_path) const;
+
+  /**
+   * @brief Keeps a flow or symmetry row of an imported model, identified by
+   * its name.
+   *
+   * @param constraint The row imported.
+   */
+  void registerConstraint(const IloRange &constraint);
+
+  /**
+   * @brief Frees the symmetry rows of a sliding bar, which are no longer valid
+   * once its objects change.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   */
+  void relaxSymmetryConstraints(int sliding_bar_idx);
+
+  /**
+   * @brief Stores the current solution, if any, as the only MIP start. CPLEX
+   * discards the solution once the model changes, so it must be called
+   * before changing it.
+   */
+  void keepSolutionAsMipStart();
+
+  /**
+   * @brief Checks that a sliding bar and an object exist.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   * @param object_id The id of the object (neither the first nor the last).
+   * @throw OpsError If any of them does not exist.
+   */
+  void checkSlidingBarObject(int sliding_bar_idx, unsigned int object_id) const;
+
+  /**
+   * @brief Checks that an object exists and is neither the first nor the
+   * last one.
+   *
+   * @param object_id The id of the object.
+   * @throw OpsError If the object does not exist.
+   */
+  void checkObject(unsigned int object_id) const;
+
+  /**
+   * @brief Checks that the sliding bars can be changed with the formulation
+   * of the model (only the MTZ rows are updated).
+   *
+   * @throw OpsError If the model uses another formulation.
+   */
+  void checkReplanningFormulation() const;
+
+  /**
+   * @brief Replaces the handler of the user cuts (if they are enabled) with
+   * one built from the current input.
+   */
+  void resetCutSeparation();
+
+  /**
+   * @brief Sets the branching priorities and directions of the observed
+   * objects from the current input, and replaces the handler of the aggregate
+   * branching (if it is enabled) with one built from it. Nothing is done with
+   * the default strategy of CPLEX.
+   */
+  void resetBranching();
+
+  /** @brief Gets the constant used by the MTZ constraints. */
+  [[nodiscard]] int getBigM() const;
+
+  /** @brief Ends every object of the model, keeping the environment alive. */
+  void endModel();
+
   /** @brief Creates the model for the problem, using the input data. */
   void makeModel();
 
@@ -140,6 +506,21 @@ class OpsCplexSolver : public OpsSolver {
    */
   void addXVariable();
 
+  /**
+   * @brief Add the 'f' variables to the model (time-flow formulation).
+   * F is a float vector with the same length as X, that stores the time each
+   * arc leaves its origin. The arcs that leave the first node leave at 0.
+   */
+  void addFVariable();
+
+  /**
+   * @brief Add the columns of the time-expanded network to the model
+   * (time-indexed formulation): whether each object is observed in each
+   * bucket (v), whether each arc is left in each bucket (z) and whether each
+   * sliding bar waits in each object to the next bucket (w).
+   */
+  void addTimeIndexedVariables();
+
   /**
    * @brief Add what is the objective equation to the model.
    * In this case, the objective is to maximize the number of objects observed
@@ -188,6 +569,29 @@ class OpsCplexSolver : public OpsSolver {
    */
   void addMTZConstraints(IloRangeArray &constraints);
 
+  /**
+   * @brief Add the time-flow constraints to the model.
+   * Each arc leaves its origin before the time limit minus its time, and only
+   * if it is used. Each sliding bar reaches a node after leaving the previous
+   * one plus the time of the arc, and leaves it at the time of the node, so
+   * every sliding bar observes an object at the same time.
+   *
+   * @param constraints The constraints to add the time-flow constraints to.
+   */
+  void addTimeFlowConstraints(IloRangeArray &constraints);
+
+  /**
+   * @brief Add the rows of the time-expanded network to the model. Each arc
+   * is left in one bucket if it is used and each object is observed in one
+   * bucket if it is observed, with its time inside that bucket. Every sliding
+   * bar that observes an object leaves it in the bucket it is observed, and
+   * reaches it before (rounding the times of the arcs down), so the network
+   * only cuts fractional solutions off and the MTZ rows keep the exact times.
+   *
+   * @param constraints The constraints to add the rows to.
+   */
+  void addTimeIndexedConstraints(IloRangeArray &constraints);
+
   /**
    * @brief Add the limit constraints to the model.
    * This constraint ensures that the starting time is zero and the ending time
@@ -197,18 +601,30 @@ class OpsCplexSolver : public OpsSolver {
    */
   void addLimitConstraints(IloRangeArray &constraints);
 
+  /**
+   * @brief Add the symmetry constraints to the model.
+   * When a sliding bar can observe every object observed by another one, and
+   * going between its objects takes time, both visit their common objects in
+   * the order of their times, so the inner one uses every arc between them
+   * used by the outer one (and both use the same arcs if they are equal).
+   *
+   * @param constraints The constraints to add the symmetry constraints to.
+   */
+  void addSymmetryConstraints(IloRangeArray &constraints);
+
   // ------------------------------- Setters ------------------------------- //
 
   /**
    * @brief Set some configuration parameters to the CPLEX solver.
-   * - The maximum time to solve the problem is 3600 seconds.
+   * - The maximum time to solve the problem.
    * - The absolute tolerance on the gap between the best integer objective and
-   * the objective of the best node remaining is 0.001.
+   * the objective of the best node remaining.
+   * - The amount of threads, if it is given.
    * - Emphasize optimality over feasibility.
    *
-   * @param tolerance The tolerance to be used in the solver.
+   * @param config The parameters of the CPLEX solver.
    */
-  void setParameters(double tolerance);
+  void setParameters(const SolverConfig &config);
 
   /**
    * @brief Set the output with the models solution
@@ -217,6 +633,14 @@ class OpsCplexSolver : public OpsSolver {
    */
   void setOutput(long time_elapsed);
 
+  /**
+   * @brief Set the values of the variables and the statistics of the search to
+   * the output.
+   *
+   * @param time_elapsed The time spent to solve the problem.
+   */
+  void setSolutionToOutput(long time_elapsed);
+
   // ------------------------------- Utility ------------------------------- //
 
   /**
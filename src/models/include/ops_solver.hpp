@@ -27,6 +27,9 @@
 #ifndef EMIR_OPS_SOLVER_HPP_
 #define EMIR_OPS_SOLVER_HPP_
 
+#include <utility>
+#include <vector>
+
 #include <local_type_traits.hpp>
 #include <ops_output.hpp>
 #include <timer.hpp>
@@ -65,6 +68,13 @@ class OpsSolver {
    */
   virtual void solve() = 0;
 
+  // ------------------------------- Getters ------------------------------- //
+
+  /** @brief Get the output with the solution found by the solver. */
+  [[nodiscard]] const OpsOutput &getOutput() const {
+    return output_;
+  }
+
   // ------------------------------ Operators ------------------------------ //
 
   /**
@@ -85,6 +95,29 @@ class OpsSolver {
     return input_;
   }
 
+  /**
+   * @brief Replaces the priorities of the input, clearing the output.
+   *
+   * @param priorities The new profit of each object.
+   */
+  void setPriorities(std::vector<int> priorities) {
+    input_.setPriorities(std::move(priorities));
+    resetOutput();
+  }
+
+  /**
+   * @brief Get the input of the solver to modify it. The output must be reset
+   * after the modification.
+   */
+  [[nodiscard]] OpsInput &getMutableInput() {
+    return input_;
+  }
+
+  /** @brief Clears the output, so it uses the current input. */
+  void resetOutput() {
+    output_ = OpsOutput(input_);
+  }
+
   // --------------------------- Output Methods ---------------------------- //
 
   /**
@@ -123,6 +156,42 @@ class OpsSolver {
     output_.setTimeSpent(time_spent);
   }
 
+  /**
+   * @brief Assign the amount of branch and bound nodes to the output.
+   *
+   * @param nodes The amount of nodes explored to find the solution.
+   */
+  void setNodesToOutput(const long nodes) {
+    output_.setNodes(nodes);
+  }
+
+  /**
+   * @brief Assign the time spent building the model to the output.
+   *
+   * @param build_time The time spent to build the model.
+   */
+  void setBuildTimeToOutput(const long build_time) {
+    output_.setBuildTime(build_time);
+  }
+
+  /**
+   * @brief Assign the amount of columns fixed before solving to the output.
+   *
+   * @param fixed_columns The amount of columns fixed.
+   */
+  void setFixedColumnsToOutput(const long fixed_columns) {
+    output_.setFixedColumns(fixed_columns);
+  }
+
+  /**
+   * @brief Assign the memory used at each phase to the output.
+   *
+   * @param memory_profile The profile with the memory used at each phase.
+   */
+  void setMemoryProfileToOutput(const MemoryProfile &memory_profile) {
+    output_.setMemoryProfile(memory_profile);
+  }
+
   /** @brief Checks if the output contains a valid solution. */
   void checkOutput() const {
     output_.check();
@@ -0,0 +1,122 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file plan.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a plan of the sliding bars that
+ * does not depend on the columns of a model, and of the functions that move
+ * it from and to the values of a model.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_PLAN_HPP_
+#define EMIR_PLAN_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include <ops_input.hpp>
+
+namespace emir {
+
+/**
+ * @brief A plan that does not depend on the columns of a model, so it can be
+ * moved from one model to another.
+ */
+struct Plan {
+  // The objects observed by each sliding bar, in order (without the first and
+  // last objects).
+  std::vector<std::vector<unsigned int>> routes;
+  // The value of the time variable of each object.
+  std::vector<double> times;
+};
+
+/**
+ * @brief Gets the index of the first time variable (s) in the values of a
+ * model, which come after the observation variables (y).
+ *
+ * @param input The input of the model.
+ */
+std::size_t getFirstTimeIdx(const OpsInput &input);
+
+/**
+ * @brief Gets the index of the first arc variable (x) in the values of a
+ * model, which come after the time variables (s).
+ *
+ * @param input The input of the model.
+ */
+std::size_t getFirstArcIdx(const OpsInput &input);
+
+/**
+ * @brief Reads the plan of a solution, following the arcs used by each
+ * sliding bar from the first object.
+ *
+ * @param input The input of the model solved.
+ * @param values The value of every variable of the model.
+ */
+Plan readPlan(const OpsInput &input, const std::vector<double> &values);
+
+/**
+ * @brief Gets the value of every variable of a model (y, s and x) that
+ * represents a plan.
+ *
+ * @param input The input of the model.
+ * @param plan The plan to represent.
+ * @throw OpsError If the model does not have an arc used by the plan.
+ */
+std::vector<double> toValues(const OpsInput &input, const Plan &plan);
+
+/**
+ * @brief Gets the profit of a solution.
+ *
+ * @param input The input of the model.
+ * @param values The value of every variable of the model.
+ */
+double getPlanProfit(const OpsInput &input, const std::vector<double> &values);
+
+/**
+ * @brief Builds a feasible plan greedily, in the order the objects are
+ * observed. Each step observes the object with the most priority per unit of
+ * time waited by the sliding bars that can observe it, which go to it from
+ * their last object and still reach the last node in time.
+ *
+ * @param input The input of the model.
+ */
+Plan buildGreedyPlan(const OpsInput &input);
+
+/**
+ * @brief Builds a feasible plan like buildGreedyPlan, guided by a fractional
+ * solution: the score of each object is multiplied by its value and the
+ * values of the arcs from the last objects of the sliding bars to it, so the
+ * routes follow the arcs the solution uses the most while the objects that
+ * do not fit in the night are skipped.
+ *
+ * @param input The input of the model.
+ * @param values The value of every variable of the model (y, s and x).
+ * @param deadline The moment the plan stops growing, so it may observe
+ * fewer objects.
+ */
+Plan buildGuidedPlan(
+  const OpsInput &input, const std::vector<double> &values,
+  std::chrono::steady_clock::time_point deadline
+);
+
+}  // namespace emir
+
+#endif  // EMIR_PLAN_HPP_
\ No newline at end of file
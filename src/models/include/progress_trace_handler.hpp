@@ -0,0 +1,52 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file progress_trace_handler.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the callback handler that
+ * records the progress of the search (incumbent, bound and gap) as counter
+ * tracks of the trace.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_PROGRESS_TRACE_HANDLER_HPP_
+#define EMIR_PROGRESS_TRACE_HANDLER_HPP_
+
+#include <solver_callback.hpp>
+
+namespace emir {
+
+/** @brief Records the incumbent, bound and gap each time CPLEX progresses. */
+class ProgressTraceHandler : public CallbackHandler {
+ public:
+  /** @brief Invoked in the global progress context. */
+  [[nodiscard]] CPXLONG getContextMask() const override {
+    return IloCplex::Callback::Context::Id::GlobalProgress;
+  }
+
+  /**
+   * @brief Adds a sample of the incumbent, bound and gap to the trace.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_PROGRESS_TRACE_HANDLER_HPP_
\ No newline at end of file
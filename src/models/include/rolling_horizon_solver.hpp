@@ -0,0 +1,172 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file rolling_horizon_solver.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a solver that plans the night in
+ * overlapping windows of time, so instances too big for the full model can be
+ * solved within a bounded time and memory.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_ROLLING_HORIZON_SOLVER_HPP_
+#define EMIR_ROLLING_HORIZON_SOLVER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include <ilcplex/ilocplex.h>
+
+#include <ops_cplex_solver.hpp>
+#include <ops_solver.hpp>
+#include <solver_config.hpp>
+#include <time_expanded_network.hpp>
+
+namespace emir {
+
+/** @brief Parameters of the rolling-horizon solver. */
+struct RollingHorizonConfig {
+  // The amount of windows the time limit of the telescope is split into.
+  int windows = 4;
+  // The part of a window shared with the next one (between 0 and 1). The
+  // objects observed in it are not fixed until the next window.
+  double overlap = 0.25;
+  // The amount of new objects each window may observe, 0 to estimate it from
+  // the times of the instance.
+  std::size_t objects_per_window = 0;
+  // The part of the time limit of the solver spent polishing the plan with the
+  // full model, 0 to skip the polishing.
+  double polish_fraction = 0.25;
+};
+
+/**
+ * @brief Solves the O.P.S. problem window by window. Each window solves a
+ * smaller model, with only the objects already planned and a few new ones,
+ * and fixes the objects observed before the next window starts. The plan of
+ * the last window is used as a MIP start of the full model, which polishes it
+ * with the time left.
+ */
+class RollingHorizonSolver : public OpsSolver {
+ public:
+  /**
+   * @brief Moves the input and keeps the parameters of the solver.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param solver_config The parameters of the CPLEX solver. Its time limit
+   * is shared by every window and the polishing.
+   * @param config The parameters of the windows.
+   */
+  RollingHorizonSolver(
+    OpsInput &&input, const SolverConfig &solver_config,
+    const RollingHorizonConfig &config
+  );
+
+  /**
+   * @brief Moves the input and keeps the parameters of the solver, building
+   * every model in an environment owned by the caller.
+   *
+   * @param input The input of the solver with the instance data.
+   * @param solver_config The parameters of the CPLEX solver. Its time limit
+   * is shared by every window and the polishing.
+   * @param config The parameters of the windows.
+   * @param environment The environment where the models are built.
+   */
+  RollingHorizonSolver(
+    OpsInput &&input, const SolverConfig &solver_config,
+    const RollingHorizonConfig &config, const IloEnv &environment
+  );
+
+  /** @brief Solves every window and polishes the plan. */
+  void solve() override;
+
+  // -------------------------------- Adders ------------------------------- //
+
+  /**
+   * @brief Add a log stream to output the log of every model solved.
+   *
+   * @param log_os The output stream to write the logs to.
+   */
+  void addLog(std::ostream &log_os) {
+    log_stream_ = &log_os;
+  }
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The parameters of the CPLEX solver.
+  SolverConfig solver_config_;
+  // The parameters of the windows.
+  RollingHorizonConfig config_;
+  // The environment lent by the caller, if any.
+  std::optional<IloEnv> environment_;
+  // The stream where the log of the models is written, if any.
+  std::ostream *log_stream_ = nullptr;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Creates the solver of a model, in the environment of the caller
+   * if there is one.
+   *
+   * @param input The input of the model.
+   * @param config The parameters of the CPLEX solver.
+   */
+  [[nodiscard]] std::unique_ptr<OpsCplexSolver>
+  createSolver(OpsInput &&input, const SolverConfig &config) const;
+
+  /**
+   * @brief Gets the amount of new objects a window may observe.
+   *
+   * @param window_length The time covered by the window.
+   */
+  [[nodiscard]] std::size_t getAmountOfCandidates(double window_length) const;
+
+  /**
+   * @brief Chooses the objects of a window: the ones already in the plan and
+   * the ones with the highest priority among those not offered to a previous
+   * window or that can still be left after the window starts (a window may
+   * not plan an object that only fits later in the night).
+   *
+   * @param is_planned Whether each object is observed by the current plan.
+   * @param is_offered Whether each object has been offered to a window, it is
+   * updated with the new objects chosen.
+   * @param time_windows The time windows of the objects in the full input.
+   * @param window_start The moment the window starts.
+   * @param amount_of_candidates The amount of new objects to add.
+   */
+  [[nodiscard]] std::vector<unsigned int> selectObjects(
+    const std::vector<bool> &is_planned, std::vector<bool> &is_offered,
+    const TimeExpandedNetwork::TimeWindows &time_windows, double window_start,
+    std::size_t amount_of_candidates
+  ) const;
+
+  /**
+   * @brief Writes a solution of the full model to the output.
+   *
+   * @param values The value of every variable of the full model (y, s and x).
+   * @param nodes The amount of nodes explored by every model.
+   */
+  void setSolutionToOutput(const std::vector<double> &values, long nodes);
+};
+
+}  // namespace emir
+
+#endif  // EMIR_ROLLING_HORIZON_SOLVER_HPP_
\ No newline at end of file
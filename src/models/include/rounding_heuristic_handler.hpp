@@ -0,0 +1,96 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file rounding_heuristic_handler.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a handler that rounds the
+ * relaxation of the nodes into feasible plans.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_ROUNDING_HEURISTIC_HANDLER_HPP_
+#define EMIR_ROUNDING_HEURISTIC_HANDLER_HPP_
+
+#include <atomic>
+#include <chrono>
+
+#include <ilcplex/ilocplex.h>
+
+#include <ops_input.hpp>
+#include <solver_callback.hpp>
+
+namespace emir {
+
+/**
+ * @brief Rounds the relaxation of a node into a plan (see buildGuidedPlan),
+ * which follows the arcs most used by each sliding bar and skips the objects
+ * that do not fit in the time limit, and gives it to CPLEX if it improves the
+ * incumbent. It runs once every some nodes, and each run is stopped after a
+ * time, so it does not slow the search down.
+ */
+class RoundingHeuristicHandler : public CallbackHandler {
+ public:
+  /**
+   * @brief Keeps the data needed to round the relaxations.
+   *
+   * @param input The input of the model, which must outlive the handler.
+   * @param variables Every variable of the model (y, s and x).
+   * @param frequency The amount of nodes between two runs, at least 1.
+   * @param time_box The maximum time of each run.
+   */
+  RoundingHeuristicHandler(
+    const OpsInput &input, const IloNumVarArray &variables, long frequency,
+    std::chrono::microseconds time_box
+  );
+
+  /** @brief Invoked in the relaxation context. */
+  [[nodiscard]] CPXLONG getContextMask() const override {
+    return IloCplex::Callback::Context::Id::Relaxation;
+  }
+
+  /**
+   * @brief Rounds the relaxation of the node if it is its turn, posting the
+   * plan if it improves the incumbent.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The minimum improvement over the incumbent to post a plan.
+  static constexpr double kMinImprovement = 1e-6;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The input of the model.
+  const OpsInput &input_;
+  // Every variable of the model (y, s and x).
+  IloNumVarArray variables_;
+  // The amount of nodes between two runs.
+  long frequency_;
+  // The maximum time of each run.
+  std::chrono::microseconds time_box_;
+  // The first node of the next run, shared by the threads of CPLEX.
+  std::atomic<long> next_node_ {0};
+};
+
+}  // namespace emir
+
+#endif  // EMIR_ROUNDING_HEURISTIC_HANDLER_HPP_
\ No newline at end of file
@@ -0,0 +1,104 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file solver_callback.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the generic callback used by the
+ * CPLEX solver. CPLEX only allows one generic callback per algorithm, so this
+ * one dispatches each context to the handlers registered for it.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_SOLVER_CALLBACK_HPP_
+#define EMIR_SOLVER_CALLBACK_HPP_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ilcplex/ilocplex.h>
+
+namespace emir {
+
+/** @brief Logic invoked by CPLEX in some contexts of the search. */
+class CallbackHandler {
+ public:
+  /** @brief Destroy the CallbackHandler object. */
+  virtual ~CallbackHandler() = default;
+
+  /**
+   * @brief Gets the contexts where the handler must be invoked, as a mask of
+   * IloCplex::Callback::Context::Id values.
+   */
+  [[nodiscard]] virtual CPXLONG getContextMask() const = 0;
+
+  /**
+   * @brief Runs the logic of the handler. It can be called concurrently from
+   * several threads of CPLEX.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  virtual void invoke(const IloCplex::Callback::Context &context) = 0;
+};
+
+/** @brief Generic callback that dispatches each context to its handlers. */
+class SolverCallback : public IloCplex::Callback::Function {
+ public:
+  /**
+   * @brief Registers a new handler.
+   *
+   * @param handler The handler to register.
+   */
+  void addHandler(std::shared_ptr<CallbackHandler> handler) {
+    handlers_.push_back(std::move(handler));
+  }
+
+  /**
+   * @brief Unregisters a handler, if it was registered.
+   *
+   * @param handler The handler to unregister.
+   */
+  void removeHandler(const std::shared_ptr<CallbackHandler> &handler) {
+    std::erase(handlers_, handler);
+  }
+
+  /** @brief Tells if there is no handler registered. */
+  [[nodiscard]] bool empty() const {
+    return handlers_.empty();
+  }
+
+  /** @brief Gets the contexts where any of the handlers must be invoked. */
+  [[nodiscard]] CPXLONG getContextMask() const;
+
+  /**
+   * @brief Invokes each handler registered for the given context.
+   *
+   * @param context The context where the callback was invoked.
+   */
+  void invoke(const IloCplex::Callback::Context &context) override;
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The handlers registered, in the order they are invoked.
+  std::vector<std::shared_ptr<CallbackHandler>> handlers_;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_SOLVER_CALLBACK_HPP_
\ No newline at end of file
@@ -0,0 +1,133 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file solver_config.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the configuration of the CPLEX solver for the O.P.S.
+ * problem.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_SOLVER_CONFIG_HPP_
+#define EMIR_SOLVER_CONFIG_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace emir {
+
+/** @brief The ways the times of the objects can be modeled. */
+enum class Formulation : std::uint8_t {
+  // A time variable per object, bounded by a big-M row per arc.
+  kMtz,
+  // A variable per arc with the time it leaves its origin, bounded by the
+  // time limit only when the arc is used.
+  kTimeFlow,
+  // The MTZ rows plus the sliding bars routed through a network of time
+  // buckets, see TimeExpandedNetwork.
+  kTimeIndexed,
+  // The time-indexed formulation if its network fits in a bucket shorter
+  // than the arcs, the MTZ one otherwise.
+  kBySize,
+};
+
+/** @brief How CPLEX chooses the variables to branch on. */
+enum class Branching : std::uint8_t {
+  // The default strategy of CPLEX.
+  kCplex,
+  // The observed objects (y) before the arcs, the ones with the most priority
+  // per unit of time first, branching up.
+  kPriorities,
+  // The priorities plus a branch on the amount of objects observed by a
+  // sliding bar whenever it is fractional, see AggregateBranchingHandler.
+  kAggregates,
+};
+
+/**
+ * @brief Gets the formulation with the given name.
+ *
+ * @param name The name of the formulation (mtz, time-flow, time-indexed or
+ * by-size).
+ * @throw std::invalid_argument If there is no formulation with that name.
+ */
+Formulation formulationFromString(std::string_view name);
+
+/**
+ * @brief Gets the name of a formulation, as accepted by formulationFromString.
+ *
+ * @param formulation The formulation.
+ */
+std::string_view toString(Formulation formulation);
+
+/**
+ * @brief Gets the branching strategy with the given name.
+ *
+ * @param name The name of the strategy (cplex, priorities or aggregates).
+ * @throw std::invalid_argument If there is no strategy with that name.
+ */
+Branching branchingFromString(std::string_view name);
+
+/**
+ * @brief Gets the name of a branching strategy, as accepted by
+ * branchingFromString.
+ *
+ * @param branching The branching strategy.
+ */
+std::string_view toString(Branching branching);
+
+/** @brief Parameters used by the CPLEX solver. */
+struct SolverConfig {
+  // Absolute tolerance on the gap between the best integer objective and the
+  // objective of the best node remaining.
+  double tolerance = 1e-4;
+  // The maximum time to solve the problem, in seconds (1 hour).
+  double time_limit = 3600.0;
+  // The amount of threads used by CPLEX, 0 lets CPLEX decide.
+  int threads = 0;
+  // Directory where the extracted models are saved and loaded from, so the
+  // same instance is not built twice. Empty to always build the model.
+  std::string model_cache {};
+  // Whether to add the rows that tie the arcs of the sliding bars contained in
+  // another one, see OpsInput::getNestedSlidingBars.
+  bool symmetry_breaking = true;
+  // Whether to separate cover and clique cuts on the observed objects, see
+  // CutSeparationHandler.
+  bool user_cuts = false;
+  // Whether to fix the columns that cannot improve a greedy plan, by their
+  // time windows and their reduced costs in the relaxation, before the model
+  // is extracted.
+  bool reduced_cost_fixing = false;
+  // How the times of the objects are modeled.
+  Formulation formulation = Formulation::kMtz;
+  // Length of the buckets of the time-indexed formulation, in the scaled time
+  // units of the input. 0 chooses the shortest one that keeps the network
+  // under a size.
+  int time_bucket = 0;
+  // How CPLEX chooses the variables to branch on.
+  Branching branching = Branching::kCplex;
+  // The amount of nodes between two runs of the rounding heuristic, see
+  // RoundingHeuristicHandler. 0 disables it.
+  int heuristic_frequency = 0;
+  // The maximum time of each run of the rounding heuristic, in seconds.
+  double heuristic_time_box = 0.01;
+};
+
+}  // namespace emir
+
+#endif  // EMIR_SOLVER_CONFIG_HPP_
\ No newline at end of file
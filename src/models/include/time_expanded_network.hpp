@@ -0,0 +1,240 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file time_expanded_network.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the time-expanded network of the
+ * sliding bars, used by the time-indexed formulation.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef EMIR_TIME_EXPANDED_NETWORK_HPP_
+#define EMIR_TIME_EXPANDED_NETWORK_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include <ops_input.hpp>
+
+namespace emir {
+
+/** @brief A range of buckets, empty if the first is after the last. */
+struct BucketRange {
+  // The first bucket of the range.
+  int first;
+  // The last bucket of the range (included).
+  int last;
+
+  /** @brief Gets the amount of buckets of the range. */
+  [[nodiscard]] int size() const {
+    return first > last ? 0 : last - first + 1;
+  }
+};
+
+/**
+ * @brief Splits the night in buckets of the same length (in the scaled time
+ * units of the input) and keeps, for each object, the buckets it can be
+ * observed in and, for each arc, the buckets it can be left in. The ranges
+ * are pruned with the shortest times from the first node and to the last
+ * one, so the arcs and objects that do not fit in the night have none.
+ *
+ * The columns of the network are numbered in this order:
+ * - One per object (from the second to the second last) and bucket it can be
+ *   observed in.
+ * - One per arc (by id) and bucket it can be left in.
+ * - One per sliding bar, object and bucket it can be observed in but the
+ *   last one, with the sliding bar waiting in the object for the next bucket.
+ */
+class TimeExpandedNetwork {
+ public:
+  /** @brief The times each node can be reached in, by node id. */
+  struct TimeWindows {
+    // The earliest time every sliding bar can reach the node.
+    std::vector<long> earliest;
+    // The latest time the node can be left to reach the last one in time.
+    std::vector<long> latest;
+  };
+
+  /**
+   * @brief Builds the network of the sliding bars of the input.
+   *
+   * @param input The input of the model.
+   * @param bucket_size The length of each bucket, at least 1.
+   */
+  TimeExpandedNetwork(const OpsInput &input, int bucket_size);
+
+  /**
+   * @brief Gets the shortest bucket that keeps the network under some amount
+   * of columns, doubling it from 1.
+   *
+   * @param input The input of the model.
+   * @param max_columns The maximum amount of columns of the network.
+   */
+  [[nodiscard]] static int
+  getBucketSize(const OpsInput &input, std::size_t max_columns);
+
+  // ------------------------------ Getters -------------------------------- //
+
+  /** @brief Gets the length of each bucket. */
+  [[nodiscard]] int getBucketSize() const {
+    return bucket_size_;
+  }
+
+  /** @brief Gets the amount of columns of the network. */
+  [[nodiscard]] std::size_t getAmountOfColumns() const {
+    return amount_of_columns_;
+  }
+
+  /**
+   * @brief Gets the buckets an object can be observed in.
+   *
+   * @param object_id The id of the object.
+   */
+  [[nodiscard]] const BucketRange &getObservations(unsigned int object_id
+  ) const {
+    return observations_[object_id];
+  }
+
+  /**
+   * @brief Gets the buckets an arc can be left in.
+   *
+   * @param arc_id The id of the arc.
+   */
+  [[nodiscard]] const BucketRange &getDepartures(unsigned int arc_id) const {
+    return departures_[arc_id];
+  }
+
+  /**
+   * @brief Gets the buckets an arc takes at least to go through, which
+   * rounds its time down.
+   *
+   * @param arc_id The id of the arc.
+   */
+  [[nodiscard]] int getTravelBuckets(unsigned int arc_id) const {
+    return travel_buckets_[arc_id];
+  }
+
+  /**
+   * @brief Gets the column of an object observed in a bucket.
+   *
+   * @param object_id The id of the object.
+   * @param bucket A bucket of its observations.
+   */
+  [[nodiscard]] std::size_t
+  getObservationColumn(unsigned int object_id, int bucket) const {
+    return observation_columns_[object_id] +
+           (std::size_t)(bucket - observations_[object_id].first);
+  }
+
+  /**
+   * @brief Gets the column of an arc left in a bucket.
+   *
+   * @param arc_id The id of the arc.
+   * @param bucket A bucket of its departures.
+   */
+  [[nodiscard]] std::size_t
+  getDepartureColumn(unsigned int arc_id, int bucket) const {
+    return departure_columns_[arc_id] +
+           (std::size_t)(bucket - departures_[arc_id].first);
+  }
+
+  /**
+   * @brief Gets the column of a sliding bar waiting in an object from a
+   * bucket to the next one.
+   *
+   * @param sliding_bar_idx The index of the sliding bar.
+   * @param object_id The id of the object.
+   * @param bucket A bucket of its observations but the last one.
+   */
+  [[nodiscard]] std::size_t getWaitingColumn(
+    int sliding_bar_idx, unsigned int object_id, int bucket
+  ) const {
+    return waiting_columns_[sliding_bar_idx][object_id] +
+           (std::size_t)(bucket - observations_[object_id].first);
+  }
+
+  /**
+   * @brief Computes the times each node can be reached in, with the shortest
+   * times of every sliding bar that can observe it (the times of the input
+   * may not satisfy the triangle inequality).
+   *
+   * @param input The input of the model.
+   */
+  [[nodiscard]] static TimeWindows computeTimeWindows(const OpsInput &input);
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The length of each bucket.
+  int bucket_size_;
+  // The buckets each object can be observed in (by object id).
+  std::vector<BucketRange> observations_;
+  // The buckets each arc can be left in (by arc id).
+  std::vector<BucketRange> departures_;
+  // The buckets each arc takes at least (by arc id).
+  std::vector<int> travel_buckets_;
+  // The first column of each object (by object id).
+  std::vector<std::size_t> observation_columns_;
+  // The first column of each arc (by arc id).
+  std::vector<std::size_t> departure_columns_;
+  // The first waiting column of each sliding bar and object (by object id).
+  std::vector<std::vector<std::size_t>> waiting_columns_;
+  // The amount of columns of the network.
+  std::size_t amount_of_columns_ = 0;
+
+  /**
+   * @brief Builds the network from the time windows already computed.
+   *
+   * @param input The input of the model.
+   * @param time_windows The times each node can be reached in.
+   * @param bucket_size The length of each bucket, at least 1.
+   */
+  TimeExpandedNetwork(
+    const OpsInput &input, const TimeWindows &time_windows, int bucket_size
+  );
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Computes the buckets each object can be observed in.
+   *
+   * @param time_windows The times each node can be reached in.
+   */
+  void computeObservations(const TimeWindows &time_windows);
+
+  /**
+   * @brief Computes the buckets each arc can be left in, so its destination
+   * is reached in time.
+   *
+   * @param input The input of the model.
+   * @param time_windows The times each node can be reached in.
+   */
+  void
+  computeDepartures(const OpsInput &input, const TimeWindows &time_windows);
+
+  /**
+   * @brief Numbers the columns of the network.
+   *
+   * @param input The input of the model.
+   */
+  void computeColumns(const OpsInput &input);
+};
+
+}  // namespace emir
+
+#endif  // EMIR_TIME_EXPANDED_NETWORK_HPP_
\ No newline at end of file
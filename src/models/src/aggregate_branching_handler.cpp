@@ -0,0 +1,86 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file aggregate_branching_handler.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the handler that branches on
+ * the amount of objects observed by each sliding bar.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <aggregate_branching_handler.hpp>
+#include <ops_input.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+AggregateBranchingHandler::AggregateBranchingHandler(
+  const OpsInput &input, const IloNumVarArray &observed_objects
+) :
+  observed_objects_ {observed_objects} {
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    objects_per_sliding_bar_.push_back(input.getObjectsPerSlidingBar(k));
+  }
+}
+
+void AggregateBranchingHandler::invoke(
+  const IloCplex::Callback::Context &context
+) {
+  IloNumArray values(context.getEnv());
+  context.getRelaxationPoint(observed_objects_, values);
+  const std::vector<unsigned int> *branch_objects = nullptr;
+  double branch_amount = 0;
+  double max_fractionality = kMinFractionality;
+  for (const auto &objects : objects_per_sliding_bar_) {
+    double amount = 0;
+    for (const auto &object_id : objects) { amount += values[object_id - 1]; }
+    const double fractionality =
+      std::min(amount - std::floor(amount), std::ceil(amount) - amount);
+    if (fractionality > max_fractionality) {
+      branch_objects = &objects;
+      branch_amount = amount;
+      max_fractionality = fractionality;
+    }
+  }
+  values.end();
+  if (branch_objects == nullptr) { return; }
+  IloExpr expression(context.getEnv());
+  for (const auto &object_id : *branch_objects) {
+    expression += observed_objects_[object_id - 1];
+  }
+  // Both children keep the bound of the node as their estimate
+  const double estimate = context.getRelaxationObjective();
+  IloRange down_branch(
+    context.getEnv(), -IloInfinity, expression, std::floor(branch_amount)
+  );
+  IloRange up_branch(
+    context.getEnv(), std::ceil(branch_amount), expression, IloInfinity
+  );
+  context.makeBranch(down_branch, estimate);
+  context.makeBranch(up_branch, estimate);
+  down_branch.end();
+  up_branch.end();
+  expression.end();
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,107 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file checkpoint.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the reading and writing of the
+ * checkpoints.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+
+#include <nlohmann/json.hpp>
+
+#include <checkpoint.hpp>
+#include <ops_error.hpp>
+
+namespace emir {
+
+namespace {
+
+// Version of the checkpoint format.
+constexpr int kCheckpointVersion = 1;
+
+/**
+ * @brief Reads a value that is null when it is unknown.
+ *
+ * @param json The JSON value.
+ * @return The value, or NaN if it is null.
+ */
+double readOptionalValue(const nlohmann::json &json) {
+  return json.is_null() ? std::numeric_limits<double>::quiet_NaN()
+                        : json.get<double>();
+}
+
+}  // namespace
+
+Checkpoint readCheckpoint(const std::string &file_path) {
+  std::ifstream checkpoint_file(file_path);
+  if (!checkpoint_file) {
+    throw OpsError("Cannot open the checkpoint '{}'", file_path);
+  }
+  try {
+    const auto json = nlohmann::json::parse(checkpoint_file);
+    if (json.at("version").get<int>() != kCheckpointVersion) {
+      throw OpsError("The checkpoint '{}' has another version", file_path);
+    }
+    return {
+      .instance_hash = json.at("instance_hash").get<std::uint64_t>(),
+      .elapsed_time = json.at("elapsed_time").get<long>(),
+      .incumbent = readOptionalValue(json.at("incumbent")),
+      .bound = readOptionalValue(json.at("bound")),
+      .values = json.at("values").get<std::vector<double>>()
+    };
+  } catch (const nlohmann::json::exception &exception) {
+    throw OpsError(
+      "The checkpoint '{}' is malformed: {}", file_path, exception.what()
+    );
+  }
+}
+
+void writeCheckpoint(
+  const Checkpoint &checkpoint, const std::string &file_path
+) {
+  const nlohmann::json json {
+    {"version", kCheckpointVersion},
+    {"instance_hash", checkpoint.instance_hash},
+    {"elapsed_time", checkpoint.elapsed_time},
+    {"incumbent", std::isnan(checkpoint.incumbent)
+                    ? nlohmann::json(nullptr)
+                    : nlohmann::json(checkpoint.incumbent)},
+    {"bound", std::isnan(checkpoint.bound) ? nlohmann::json(nullptr)
+                                           : nlohmann::json(checkpoint.bound)},
+    {"values", checkpoint.values}
+  };
+  const auto temporary_path = file_path + ".tmp";
+  {
+    std::ofstream checkpoint_file(temporary_path);
+    checkpoint_file << json;
+    if (!checkpoint_file.flush()) { return; }
+  }
+  // A checkpoint that cannot be written must not stop the search
+  std::error_code error;
+  std::filesystem::rename(temporary_path, file_path, error);
+}
+
+}  // namespace emir
\ No newline at end of file
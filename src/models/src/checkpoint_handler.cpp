@@ -0,0 +1,89 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file checkpoint_handler.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the callback handler that
+ * writes checkpoints.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <checkpoint.hpp>
+#include <checkpoint_handler.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+namespace {
+
+// CPLEX reports values beyond this one when there is no incumbent yet.
+constexpr double kInfinity = 1e70;
+
+}  // namespace
+
+CheckpointHandler::CheckpointHandler(
+  std::string file_path, const std::chrono::seconds interval,
+  const IloNumVarArray &variables, const std::uint64_t instance_hash,
+  const long elapsed_time
+) :
+  file_path_ {std::move(file_path)}, interval_ {interval},
+  variables_ {variables}, instance_hash_ {instance_hash},
+  elapsed_time_ {elapsed_time}, start_ {std::chrono::steady_clock::now()},
+  last_write_ {start_} {}
+
+void CheckpointHandler::invoke(const IloCplex::Callback::Context &context) {
+  // The threads that find another one writing skip this checkpoint
+  const std::unique_lock lock(mutex_, std::try_to_lock);
+  if (!lock.owns_lock()) { return; }
+  const auto now = std::chrono::steady_clock::now();
+  if (now - last_write_ < interval_) { return; }
+  last_write_ = now;
+
+  using Info = IloCplex::Callback::Context::Info;
+  const double incumbent = context.getDoubleInfo(Info::BestSolution);
+  const double bound = context.getDoubleInfo(Info::BestBound);
+  constexpr double kUnknown = std::numeric_limits<double>::quiet_NaN();
+  Checkpoint checkpoint {
+    .instance_hash = instance_hash_,
+    .elapsed_time =
+      elapsed_time_ +
+      (long)std::chrono::duration_cast<std::chrono::milliseconds>(now - start_)
+        .count(),
+    .incumbent = std::abs(incumbent) < kInfinity ? incumbent : kUnknown,
+    .bound = std::abs(bound) < kInfinity ? bound : kUnknown,
+    .values = {}
+  };
+  if (!std::isnan(checkpoint.incumbent)) {
+    IloNumArray values(context.getEnv());
+    context.getIncumbent(variables_, values);
+    checkpoint.values.reserve(values.getSize());
+    for (IloInt idx = 0; idx < values.getSize(); ++idx) {
+      checkpoint.values.push_back(values[idx]);
+    }
+    values.end();
+  }
+  writeCheckpoint(checkpoint, file_path_);
+}
+
+}  // namespace emir
+
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,88 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file cplex_environment_pool.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the pool of CPLEX
+ * environments.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <utility>
+
+#include <cplex_environment_pool.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+// --------------------------------- Lease --------------------------------- //
+
+CplexEnvironmentPool::Lease::Lease(
+  CplexEnvironmentPool *pool, IloEnv environment, const std::size_t uses
+) :
+  pool_ {pool}, environment_ {environment}, uses_ {uses} {}
+
+CplexEnvironmentPool::Lease::Lease(Lease &&other) noexcept :
+  pool_ {std::exchange(other.pool_, nullptr)},
+  environment_ {other.environment_}, uses_ {other.uses_} {}
+
+CplexEnvironmentPool::Lease::~Lease() {
+  if (pool_ != nullptr) { pool_->release(environment_, uses_); }
+}
+
+// --------------------------------- Pool ---------------------------------- //
+
+CplexEnvironmentPool::~CplexEnvironmentPool() {
+  for (auto &idle_environment : idle_environments_) {
+    idle_environment.environment.end();
+  }
+}
+
+CplexEnvironmentPool::Lease CplexEnvironmentPool::acquire() {
+  {
+    const std::lock_guard lock(mutex_);
+    if (!idle_environments_.empty()) {
+      const auto idle_environment = idle_environments_.back();
+      idle_environments_.pop_back();
+      return {this, idle_environment.environment, idle_environment.uses + 1};
+    }
+    ++created_environments_;
+  }
+  // Creating the environment is the slow part, so it is done unlocked
+  return {this, IloEnv(), 1};
+}
+
+std::size_t CplexEnvironmentPool::getCreatedEnvironments() const {
+  const std::lock_guard lock(mutex_);
+  return created_environments_;
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+void CplexEnvironmentPool::release(IloEnv environment, const std::size_t uses) {
+  if (uses >= kMaxUses) {
+    environment.end();
+    return;
+  }
+  const std::lock_guard lock(mutex_);
+  idle_environments_.push_back({.environment = environment, .uses = uses});
+}
+
+}  // namespace emir
+
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,268 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file cut_separation_handler.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the handler that separates
+ * cover and clique cuts on the observed objects.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include <cut_separation_handler.hpp>
+#include <ops_input.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+namespace {
+
+// Distance between two nodes without a path between them.
+constexpr long kUnreachable = std::numeric_limits<long>::max() / 4;
+
+}  // namespace
+
+CutSeparationHandler::CutSeparationHandler(
+  const OpsInput &input, const IloNumVarArray &observed_objects
+) :
+  observed_objects_ {observed_objects},
+  are_incompatible_(
+    input.getAmountOfObjects(),
+    std::vector<bool>(input.getAmountOfObjects(), false)
+  ),
+  is_unreachable_(input.getAmountOfObjects(), false) {
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    addSlidingBar(input, k);
+  }
+}
+
+void CutSeparationHandler::invoke(const IloCplex::Callback::Context &context) {
+  IloNumArray values(context.getEnv());
+  context.getRelaxationPoint(observed_objects_, values);
+  addCoverCuts(context, values);
+  addCliqueCuts(context, values);
+  values.end();
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+void CutSeparationHandler::addSlidingBar(
+  const OpsInput &input, const int sliding_bar_idx
+) {
+  const auto &objects = input.getObjectsPerSlidingBar(sliding_bar_idx);
+  const auto time_limit = (long)input.getTimeLimit();
+  // The nodes of the sliding bar: the first one, its objects and the last one
+  std::vector<unsigned int> nodes {0};
+  nodes.insert(nodes.end(), objects.begin(), objects.end());
+  nodes.push_back((unsigned int)input.getAmountOfObjects() - 1);
+  const auto amount_of_nodes = nodes.size();
+  const auto last_idx = amount_of_nodes - 1;
+  // Shortest times between the nodes, since the times of T may not satisfy
+  // the triangle inequality
+  std::vector<std::vector<long>> distances(
+    amount_of_nodes, std::vector<long>(amount_of_nodes, kUnreachable)
+  );
+  for (std::size_t origin = 0; origin < last_idx; ++origin) {
+    distances[origin][origin] = 0;
+    for (std::size_t destination = 1; destination < amount_of_nodes;
+         ++destination) {
+      if (origin == destination) { continue; }
+      distances[origin][destination] =
+        input.getTimeToProcess({nodes[origin], nodes[destination]});
+    }
+  }
+  for (std::size_t middle = 1; middle < last_idx; ++middle) {
+    for (std::size_t origin = 0; origin < last_idx; ++origin) {
+      for (std::size_t destination = 1; destination < amount_of_nodes;
+           ++destination) {
+        distances[origin][destination] = std::min(
+          distances[origin][destination],
+          distances[origin][middle] + distances[middle][destination]
+        );
+      }
+    }
+  }
+  const auto route_time = [&](const std::size_t first, const std::size_t second
+                          ) {
+    return distances[0][first] + distances[first][second] +
+           distances[second][last_idx];
+  };
+  for (std::size_t first = 1; first < last_idx; ++first) {
+    if (distances[0][first] + distances[first][last_idx] > time_limit) {
+      is_unreachable_[nodes[first]] = true;
+    }
+    for (std::size_t second = first + 1; second < last_idx; ++second) {
+      if (std::min(route_time(first, second), route_time(second, first)) >
+          time_limit) {
+        are_incompatible_[nodes[first]][nodes[second]] = true;
+        are_incompatible_[nodes[second]][nodes[first]] = true;
+      }
+    }
+  }
+  // Every object observed is reached by one arc, and another arc reaches the
+  // last node
+  Knapsack knapsack {.objects = {}, .weights = {}, .capacity = 0};
+  long min_time_to_end = kUnreachable;
+  for (std::size_t origin = 0; origin < last_idx; ++origin) {
+    min_time_to_end = std::min(
+      min_time_to_end,
+      (long)input.getTimeToProcess({nodes[origin], nodes[last_idx]})
+    );
+  }
+  knapsack.capacity = (int)(time_limit - min_time_to_end);
+  long total_weight = 0;
+  for (std::size_t destination = 1; destination < last_idx; ++destination) {
+    long weight = kUnreachable;
+    for (std::size_t origin = 0; origin < last_idx; ++origin) {
+      if (origin == destination) { continue; }
+      weight = std::min(
+        weight,
+        (long)input.getTimeToProcess({nodes[origin], nodes[destination]})
+      );
+    }
+    if (weight <= 0) { continue; }
+    knapsack.objects.push_back(nodes[destination]);
+    knapsack.weights.push_back((int)weight);
+    total_weight += weight;
+  }
+  if (total_weight > knapsack.capacity) {
+    knapsacks_.push_back(std::move(knapsack));
+  }
+}
+
+void CutSeparationHandler::addCoverCuts(
+  const IloCplex::Callback::Context &context, const IloNumArray &values
+) const {
+  for (const auto &[objects, weights, capacity] : knapsacks_) {
+    const auto value_of = [&](const std::size_t idx) {
+      return values[objects[idx] - 1];
+    };
+    // The objects most observed per unit of time go first, so the cover is
+    // the most violated one
+    std::vector<std::size_t> order(objects.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(
+      order,
+      [&](const std::size_t first, const std::size_t second) {
+        return (1 - value_of(first)) / weights[first] <
+               (1 - value_of(second)) / weights[second];
+      }
+    );
+    std::vector<std::size_t> cover;
+    long weight = 0;
+    for (const auto &idx : order) {
+      cover.push_back(idx);
+      weight += weights[idx];
+      if (weight > capacity) { break; }
+    }
+    if (weight <= capacity) { continue; }
+    // The cover is made minimal dropping first the objects less observed
+    std::ranges::sort(
+      cover,
+      [&](const std::size_t first, const std::size_t second) {
+        return value_of(first) < value_of(second);
+      }
+    );
+    std::vector<bool> is_in_cover(objects.size(), false);
+    std::size_t cover_size = 0;
+    int max_weight = 0;
+    for (const auto &idx : cover) {
+      if (weight - weights[idx] > capacity) {
+        weight -= weights[idx];
+        continue;
+      }
+      is_in_cover[idx] = true;
+      ++cover_size;
+      max_weight = std::max(max_weight, weights[idx]);
+    }
+    // Extended cover: the objects that take as long as any of the cover
+    std::vector<unsigned int> cut_objects;
+    double observed = 0;
+    for (std::size_t idx = 0; idx < objects.size(); ++idx) {
+      if (is_in_cover[idx] || weights[idx] >= max_weight) {
+        cut_objects.push_back(objects[idx]);
+        observed += value_of(idx);
+      }
+    }
+    if (observed > (double)cover_size - 1 + kMinViolation) {
+      addCut(context, cut_objects, (int)cover_size - 1);
+    }
+  }
+}
+
+void CutSeparationHandler::addCliqueCuts(
+  const IloCplex::Callback::Context &context, const IloNumArray &values
+) const {
+  std::vector<unsigned int> candidates;
+  for (unsigned int object_id = 1; object_id <= values.getSize();
+       ++object_id) {
+    if (values[object_id - 1] <= kMinViolation) { continue; }
+    // An object that cannot be observed at all is a clique by itself
+    if (is_unreachable_[object_id]) {
+      addCut(context, {object_id}, 0);
+    } else {
+      candidates.push_back(object_id);
+    }
+  }
+  std::ranges::sort(
+    candidates,
+    [&](const unsigned int first, const unsigned int second) {
+      return values[first - 1] > values[second - 1];
+    }
+  );
+  std::set<std::vector<unsigned int>> cliques_added;
+  for (const auto &start_id : candidates) {
+    std::vector<unsigned int> clique {start_id};
+    double observed = values[start_id - 1];
+    for (const auto &object_id : candidates) {
+      if (object_id == start_id) { continue; }
+      if (std::ranges::all_of(clique, [&](const unsigned int member_id) {
+            return are_incompatible_[object_id][member_id];
+          })) {
+        clique.push_back(object_id);
+        observed += values[object_id - 1];
+      }
+    }
+    if (clique.size() < 2 || observed <= 1 + kMinViolation) { continue; }
+    std::ranges::sort(clique);
+    if (cliques_added.insert(clique).second) { addCut(context, clique, 1); }
+  }
+}
+
+void CutSeparationHandler::addCut(
+  const IloCplex::Callback::Context &context,
+  const std::vector<unsigned int> &objects, const int max_observed
+) const {
+  IloExpr expression(context.getEnv());
+  for (const auto &object_id : objects) {
+    expression += observed_objects_[object_id - 1];
+  }
+  IloRange cut(context.getEnv(), -IloInfinity, expression, max_observed);
+  context.addUserCut(cut, IloCplex::UseCutPurge, IloFalse);
+  cut.end();
+  expression.end();
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,259 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file ops_cp_solver.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the solver that uses CP
+ * Optimizer to solve the O.P.S. problem.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <memory.hpp>
+#include <ops_cp_solver.hpp>
+#include <ops_error.hpp>
+#include <ops_input.hpp>
+#include <ops_solver.hpp>
+#include <phase.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+OpsCpSolver::OpsCpSolver(OpsInput &&input, const SolverConfig &config) :
+  OpsSolver(std::move(input)), cp_(environment_), model_(environment_),
+  observations_(environment_),
+  transition_distance_(
+    environment_, (IloInt)getInput().getAmountOfObjects()
+  ) {
+  setUp(config);
+}
+
+OpsCpSolver::OpsCpSolver(
+  OpsInput &&input, const SolverConfig &config, const IloEnv &environment
+) :
+  OpsSolver(std::move(input)), environment_(environment),
+  owns_environment_ {false}, cp_(environment_), model_(environment_),
+  observations_(environment_),
+  transition_distance_(
+    environment_, (IloInt)getInput().getAmountOfObjects()
+  ) {
+  setUp(config);
+}
+
+OpsCpSolver::~OpsCpSolver() {
+  if (owns_environment_) {
+    environment_.end();
+  } else {
+    endModel();
+  }
+}
+
+void OpsCpSolver::solve() {
+  try {
+    resetTimer();
+    bool has_solution = false;
+    {
+      const PhaseScope phase("solve");
+      has_solution = cp_.solve();
+    }
+    if (!has_solution) {
+      std::cerr << "CP Optimizer found no plan\n";
+      return;
+    }
+    {
+      const PhaseScope phase("output");
+      setSolutionToOutput(getElapsedTime<std::chrono::milliseconds>());
+    }
+    setMemoryProfileToOutput(MemoryProfile::current());
+    MemoryProfile::current().clear();
+    checkOutput();
+  } catch (const IloException &ex) {
+    std::cerr << "IloException: " << ex << '\n';
+    return;
+  }
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+void OpsCpSolver::setUp(const SolverConfig &config) {
+  resetTimer();
+  cp_.setParameter(IloCP::TimeLimit, config.time_limit);
+  cp_.setParameter(IloCP::OptimalityTolerance, config.tolerance);
+  if (config.threads > 0) { cp_.setParameter(IloCP::Workers, config.threads); }
+  {
+    const PhaseScope phase("model build");
+    const AllocationScope allocation_scope(AllocationCategory::kModel);
+    const auto &input = getInput();
+    const auto amount_of_objects = (IloInt)input.getAmountOfObjects();
+    for (IloInt origin_id = 0; origin_id < amount_of_objects; ++origin_id) {
+      for (IloInt destination_id = 0; destination_id < amount_of_objects;
+           ++destination_id) {
+        transition_distance_.setValue(
+          origin_id, destination_id,
+          origin_id == destination_id
+            ? 0
+            : input.getTimeToProcess(
+                {(std::size_t)origin_id, (std::size_t)destination_id}
+              )
+        );
+      }
+    }
+    addObservations();
+    for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) { addRoute(k); }
+  }
+  {
+    const PhaseScope phase("extract");
+    cp_.extract(model_);
+  }
+  setBuildTimeToOutput(getElapsedTime<std::chrono::milliseconds>());
+}
+
+void OpsCpSolver::addObservations() {
+  const auto &input = getInput();
+  IloIntExpr profit(environment_);
+  for (int node_idx = 1; node_idx < input.getAmountOfObjects() - 1;
+       ++node_idx) {
+    IloIntervalVar observation(
+      environment_, 0, std::format("observation_{}", node_idx).c_str()
+    );
+    observation.setOptional();
+    observation.setEndMax(input.getTimeLimit());
+    observations_.add(observation);
+    profit += input.getPriority(node_idx) *
+              IloPresenceOf(environment_, observation);
+  }
+  model_.add(IloMaximize(environment_, profit));
+  profit.end();
+}
+
+void OpsCpSolver::addRoute(const int sliding_bar_idx) {
+  const auto &input = getInput();
+  const auto &objects = input.getObjectsPerSlidingBar(sliding_bar_idx);
+  auto &nodes = nodes_.emplace_back(std::vector<unsigned int> {0});
+  nodes.insert(nodes.end(), objects.begin(), objects.end());
+  nodes.push_back((unsigned int)input.getAmountOfObjects() - 1);
+  auto &visits = visits_.emplace_back(environment_);
+  IloIntArray types(environment_);
+  for (const auto &node_id : nodes) {
+    visits.add(IloIntervalVar(
+      environment_, 0,
+      std::format("visit_{}_{}", sliding_bar_idx + 1, node_id).c_str()
+    ));
+    types.add(node_id);
+  }
+  auto &first_visit = visits[0];
+  auto &last_visit = visits[visits.getSize() - 1];
+  first_visit.setStartMax(0);
+  last_visit.setEndMax(input.getTimeLimit());
+  // The sliding bars that can observe an object visit it when it is
+  // observed, and only then
+  for (IloInt idx = 1; idx < visits.getSize() - 1; ++idx) {
+    auto &visit = visits[idx];
+    const auto &observation = observations_[nodes[idx] - 1];
+    visit.setOptional();
+    model_.add(
+      IloPresenceOf(environment_, visit) ==
+      IloPresenceOf(environment_, observation)
+    );
+    model_.add(IloStartAtStart(environment_, visit, observation));
+  }
+  const auto &route = routes_.emplace_back(
+    environment_, visits, types,
+    std::format("route_{}", sliding_bar_idx + 1).c_str()
+  );
+  // Direct, so the times of T only separate consecutive visits, as the arcs
+  // of the graph
+  model_.add(IloNoOverlap(environment_, route, transition_distance_, IloTrue)
+  );
+  model_.add(IloFirst(environment_, route, first_visit));
+  model_.add(IloLast(environment_, route, last_visit));
+  types.end();
+}
+
+void OpsCpSolver::setSolutionToOutput(const long time_elapsed) {
+  const AllocationScope allocation_scope(AllocationCategory::kOutput);
+  const auto &input = getInput();
+  const auto amount_of_objects = input.getAmountOfObjects();
+  std::vector<double> used_arcs(input.getAmountOfArcs(), 0);
+  std::vector<double> observed_objects(amount_of_objects - 2, 0);
+  std::vector<double> time_at_objects(amount_of_objects, 0);
+  for (std::size_t object_idx = 0; object_idx < amount_of_objects - 2;
+       ++object_idx) {
+    if (!cp_.isPresent(observations_[(IloInt)object_idx])) { continue; }
+    observed_objects[object_idx] = 1;
+    time_at_objects[object_idx + 1] =
+      (double)cp_.getStart(observations_[(IloInt)object_idx]);
+  }
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto &graph = input.getGraph(k);
+    const auto &visits = visits_[k];
+    std::map<IloInt, unsigned int> node_of_visit;
+    for (IloInt idx = 0; idx < visits.getSize(); ++idx) {
+      node_of_visit.emplace(visits[idx].getId(), nodes_[k][idx]);
+    }
+    const auto &last_visit = visits[visits.getSize() - 1];
+    auto visit = cp_.getFirst(routes_[k]);
+    while (visit.getId() != last_visit.getId()) {
+      const auto next_visit = cp_.getNext(routes_[k], visit);
+      const auto origin_id = node_of_visit.at(visit.getId());
+      const auto destination_id = node_of_visit.at(next_visit.getId());
+      const auto arc_id = graph.getArcId(
+        {.origin_id = origin_id, .destination_id = destination_id}
+      );
+      if (!arc_id) {
+        throw OpsError(
+          "The sliding bar {} goes from {} to {}, which is not an arc", k + 1,
+          origin_id, destination_id
+        );
+      }
+      used_arcs[*arc_id] = 1;
+      visit = next_visit;
+    }
+    time_at_objects.back() =
+      std::max(time_at_objects.back(), (double)cp_.getStart(last_visit));
+  }
+  setUsedArcsToOutput(used_arcs);
+  setObservedObjectsToOutput(observed_objects);
+  setTimeAtObjectsToOutput(time_at_objects);
+  setTimeSpentToOutput(time_elapsed);
+  setNodesToOutput(cp_.getInfo(IloCP::NumberOfBranches));
+}
+
+void OpsCpSolver::endModel() {
+  cp_.end();
+  model_.end();
+  for (auto &visits : visits_) {
+    visits.endElements();
+    visits.end();
+  }
+  for (auto &route : routes_) { route.end(); }
+  observations_.endElements();
+  observations_.end();
+  transition_distance_.end();
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
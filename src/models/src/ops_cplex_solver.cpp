@@ -24,45 +24,106 @@
 // clang-format on
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
 #include <format>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include <unistd.h>
+
+#include <aggregate_branching_handler.hpp>
+#include <checkpoint_handler.hpp>
+#include <cut_separation_handler.hpp>
+#include <memory.hpp>
+#include <ops_error.hpp>
+#include <phase.hpp>
+#include <progress_trace_handler.hpp>
+#include <rounding_heuristic_handler.hpp>
+#include <trace.hpp>
 #include <ops_cplex_solver.hpp>
 #include <ops_input.hpp>
 #include <ops_solver.hpp>
+#include <plan.hpp>
 
 // NOLINTBEGIN(misc-include-cleaner)
 namespace emir {
 
+namespace fs = std::filesystem;
+
 OpsCplexSolver::OpsCplexSolver(const OpsInput &input, const double tolerance) :
   OpsSolver(input), cplex_(environment_), model_(environment_),
   used_arcs_(environment_), observed_objects_(environment_),
-  time_at_objects_(environment_) {
-  setParameters(tolerance);
-  makeModel();
-  cplex_.extract(model_);
+  time_at_objects_(environment_), variables_(environment_),
+  time_flows_(environment_), time_buckets_(environment_) {
+  setUp({.tolerance = tolerance});
 }
 
 OpsCplexSolver::OpsCplexSolver(OpsInput &&input, const double tolerance) :
   OpsSolver(std::move(input)), cplex_(environment_), model_(environment_),
   used_arcs_(environment_), observed_objects_(environment_),
-  time_at_objects_(environment_) {
-  setParameters(tolerance);
-  makeModel();
-  cplex_.extract(model_);
+  time_at_objects_(environment_), variables_(environment_),
+  time_flows_(environment_), time_buckets_(environment_) {
+  setUp({.tolerance = tolerance});
+}
+
+OpsCplexSolver::OpsCplexSolver(
+  OpsInput &&input, const SolverConfig &config
+) :
+  OpsSolver(std::move(input)), cplex_(environment_), model_(environment_),
+  used_arcs_(environment_), observed_objects_(environment_),
+  time_at_objects_(environment_), variables_(environment_),
+  time_flows_(environment_), time_buckets_(environment_) {
+  setUp(config);
+}
+
+OpsCplexSolver::OpsCplexSolver(
+  OpsInput &&input, const SolverConfig &config, const IloEnv &environment
+) :
+  OpsSolver(std::move(input)), environment_(environment),
+  owns_environment_ {false}, cplex_(environment_), model_(environment_),
+  used_arcs_(environment_), observed_objects_(environment_),
+  time_at_objects_(environment_), variables_(environment_),
+  time_flows_(environment_), time_buckets_(environment_) {
+  setUp(config);
 }
 
 OpsCplexSolver::~OpsCplexSolver() {
-  environment_.end();
+  if (owns_environment_) {
+    environment_.end();
+  } else {
+    endModel();
+  }
 }
 
 void OpsCplexSolver::solve() {
   try {
     resetTimer();
-    cplex_.solve();
-    setOutput(getElapsedTime<std::chrono::milliseconds>());
+    // The path is cleared, so solving again does not add another handler
+    if (!checkpoint_path_.empty()) {
+      addCallbackHandler(std::make_shared<CheckpointHandler>(
+        std::exchange(checkpoint_path_, {}), checkpoint_interval_, variables_,
+        getInput().getContentHash(), resumed_time_
+      ));
+    }
+    if (!callback_.empty()) {
+      cplex_.use(&callback_, callback_.getContextMask());
+    }
+    {
+      const PhaseScope phase("solve");
+      cplex_.solve();
+    }
+    setOutput(getElapsedTime<std::chrono::milliseconds>() + resumed_time_);
     checkOutput();
   } catch (const IloException &ex) {
     std::cerr << "IloException: " << ex << '\n';
@@ -70,12 +131,636 @@ void OpsCplexSolver::solve() {
   }
 }
 
+void OpsCplexSolver::addMipStart(const std::vector<double> &values) {
+  if (values.size() != (std::size_t)variables_.getSize()) {
+    throw OpsError(
+      "The MIP start has {} values, but the model has {} variables",
+      values.size(), variables_.getSize()
+    );
+  }
+  IloNumArray start_values(environment_);
+  for (const auto value : values) { start_values.add(value); }
+  cplex_.addMIPStart(variables_, start_values, IloCplex::MIPStartRepair);
+  start_values.end();
+}
+
+void OpsCplexSolver::updatePriorities(const std::vector<int> &priorities) {
+  const auto amount_of_objects = getInput().getAmountOfObjects();
+  if (priorities.size() != amount_of_objects) {
+    throw OpsError(
+      "Expected {} priorities, but {} were given", amount_of_objects,
+      priorities.size()
+    );
+  }
+  resetTimer();
+  // The solution is still feasible, only its profit changes
+  keepSolutionAsMipStart();
+  releasePresolveFixings();
+  IloNumArray coefficients(environment_);
+  for (std::size_t node_idx = 1; node_idx < amount_of_objects - 1;
+       ++node_idx) {
+    coefficients.add(priorities[node_idx]);
+  }
+  objective_.setLinearCoefs(observed_objects_, coefficients);
+  coefficients.end();
+  setPriorities(priorities);
+  resetBranching();
+  setBuildTimeToOutput(getElapsedTime<std::chrono::milliseconds>());
+}
+
+double OpsCplexSolver::getRelaxationBound() const {
+  IloNumVarArray variables(environment_);
+  IloNumArray values(environment_);
+  IloNumArray reduced_costs(environment_);
+  const auto bound = solveRelaxation(variables, values, reduced_costs);
+  variables.end();
+  values.end();
+  reduced_costs.end();
+  return bound.value_or(0.0);
+}
+
+// ----------------------------- Re-planning ------------------------------ //
+
+void OpsCplexSolver::addObjectToSlidingBar(
+  const int sliding_bar_idx, const unsigned int object_id
+) {
+  checkSlidingBarObject(sliding_bar_idx, object_id);
+  checkReplanningFormulation();
+  const auto &objects = getInput().getObjectsPerSlidingBar(sliding_bar_idx);
+  if (std::ranges::find(objects, object_id) != objects.end()) { return; }
+  resetTimer();
+  // The current plan stays feasible, the object is simply not observed
+  keepSolutionAsMipStart();
+  releasePresolveFixings();
+  relaxSymmetryConstraints(sliding_bar_idx);
+  const auto first_new_arc_id = (unsigned int)used_arcs_.getSize();
+  // The new arcs follow the last one, so their columns are appended in order
+  getMutableInput().addObjectToSlidingBar(sliding_bar_idx, object_id);
+  resetOutput();
+  resetCutSeparation();
+  resetBranching();
+  const auto &input = getInput();
+  const auto &graph = input.getGraph(sliding_bar_idx);
+  const auto last_node_id = (unsigned int)input.getAmountOfObjects() - 1;
+  auto &delta_plus = delta_plus_constraints_[sliding_bar_idx];
+  auto &delta_minus = delta_minus_constraints_[sliding_bar_idx];
+  if (delta_plus.contains(object_id)) {
+    // The object was in the sliding bar before, its rows were freed
+    delta_plus.at(object_id).setBounds(0, 0);
+    delta_minus.at(object_id).setBounds(0, 0);
+  } else {
+    const auto add_delta = [&](auto &delta, const std::string_view prefix) {
+      IloExpr expression(environment_);
+      expression -= observed_objects_[object_id - 1];
+      const IloRange constraint(
+        environment_, 0, expression, 0,
+        std::format("{}_{}_{}", prefix, sliding_bar_idx + 1, object_id).c_str()
+      );
+      model_.add(constraint);
+      delta.emplace(object_id, constraint);
+      expression.end();
+    };
+    add_delta(delta_plus, "deltaplus");
+    add_delta(delta_minus, "deltaminus");
+  }
+  // Arcs kept from a previous time the object was in the sliding bar
+  const auto &observable_objects =
+    input.getObjectsPerSlidingBar(sliding_bar_idx);
+  const auto is_observable = [&](const unsigned int node_id) {
+    return node_id == 0 || node_id == last_node_id ||
+           std::ranges::find(observable_objects, node_id) !=
+             observable_objects.end();
+  };
+  for (const auto &arc : graph.getArcs()) {
+    if (arc.getId() >= first_new_arc_id) { continue; }
+    const auto origin_id = arc.getOriginId();
+    const auto destination_id = arc.getDestinationId();
+    if ((origin_id == object_id && is_observable(destination_id)) ||
+        (destination_id == object_id && is_observable(origin_id))) {
+      used_arcs_[arc.getId()].setUB(1);
+    }
+  }
+  const int big_m = getBigM();
+  for (const auto &arc : graph.getArcs()) {
+    if (arc.getId() < first_new_arc_id) { continue; }
+    const auto origin_id = arc.getOriginId();
+    const auto destination_id = arc.getDestinationId();
+    const IloNumVar used_arc(
+      environment_, 0, 1, IloNumVar::Bool,
+      std::format("x_{}_{}_{}", sliding_bar_idx + 1, origin_id, destination_id)
+        .c_str()
+    );
+    used_arcs_.add(used_arc);
+    variables_.add(used_arc);
+    model_.add(used_arc);
+    delta_plus.at(origin_id).setLinearCoef(used_arc, 1);
+    delta_minus.at(destination_id).setLinearCoef(used_arc, 1);
+    IloExpr expression(environment_);
+    expression = big_m * used_arc + time_at_objects_[origin_id] -
+                 time_at_objects_[destination_id];
+    model_.add(IloRange(
+      environment_, -IloInfinity, expression,
+      big_m - input.getTimeToProcess({origin_id, destination_id}),
+      std::format(
+        "MTZ_{}_{}_{}", sliding_bar_idx + 1, origin_id, destination_id
+      )
+        .c_str()
+    ));
+    expression.end();
+  }
+  setBuildTimeToOutput(getElapsedTime<std::chrono::milliseconds>());
+}
+
+void OpsCplexSolver::removeObjectFromSlidingBar(
+  const int sliding_bar_idx, const unsigned int object_id
+) {
+  checkSlidingBarObject(sliding_bar_idx, object_id);
+  checkReplanningFormulation();
+  const auto &objects = getInput().getObjectsPerSlidingBar(sliding_bar_idx);
+  if (std::ranges::find(objects, object_id) == objects.end()) { return; }
+  resetTimer();
+  // If the plan observes the object with this sliding bar CPLEX repairs it
+  keepSolutionAsMipStart();
+  releasePresolveFixings();
+  relaxSymmetryConstraints(sliding_bar_idx);
+  // The columns and rows are kept (so every id stays valid): the arcs are
+  // fixed to 0 and the flow rows of the object are freed, so the object may
+  // still be observed by the other sliding bars
+  const auto &graph = getInput().getGraph(sliding_bar_idx);
+  for (const auto &arc_id : graph.getSuccessorsArcsId(object_id)) {
+    used_arcs_[arc_id].setUB(0);
+  }
+  for (const auto &arc_id : graph.getPredecessorsArcsId(object_id)) {
+    used_arcs_[arc_id].setUB(0);
+  }
+  delta_plus_constraints_[sliding_bar_idx]
+    .at(object_id)
+    .setBounds(-IloInfinity, IloInfinity);
+  delta_minus_constraints_[sliding_bar_idx]
+    .at(object_id)
+    .setBounds(-IloInfinity, IloInfinity);
+  getMutableInput().removeObjectFromSlidingBar(sliding_bar_idx, object_id);
+  resetOutput();
+  resetCutSeparation();
+  resetBranching();
+  setBuildTimeToOutput(getElapsedTime<std::chrono::milliseconds>());
+}
+
+void OpsCplexSolver::fixObject(
+  const unsigned int object_id, const double time
+) {
+  checkObject(object_id);
+  releasePresolveFixings();
+  observed_objects_[object_id - 1].setLB(1);
+  time_at_objects_[object_id].setBounds(time, time);
+}
+
+// ------------------------------ Checkpoints ------------------------------ //
+
+void OpsCplexSolver::enableCheckpoints(
+  std::string file_path, const std::chrono::seconds interval
+) {
+  checkpoint_path_ = std::move(file_path);
+  checkpoint_interval_ = interval;
+}
+
+void OpsCplexSolver::resume(const Checkpoint &checkpoint) {
+  if (checkpoint.instance_hash != getInput().getContentHash()) {
+    throw OpsError("The checkpoint belongs to another instance");
+  }
+  if (!checkpoint.values.empty()) { addMipStart(checkpoint.values); }
+  const double time_limit = cplex_.getParam(IloCplex::Param::TimeLimit);
+  cplex_.setParam(
+    IloCplex::Param::TimeLimit,
+    std::max(1.0, time_limit - (double)checkpoint.elapsed_time / 1000)
+  );
+  resumed_time_ = checkpoint.elapsed_time;
+}
+
 // ---------------------------- Private Methods ---------------------------- //
 
+void OpsCplexSolver::setUp(const SolverConfig &config) {
+  if (TraceRecorder::instance().isEnabled()) {
+    addCallbackHandler(std::make_shared<ProgressTraceHandler>());
+  }
+  resetTimer();
+  symmetry_breaking_ = config.symmetry_breaking;
+  reduced_cost_fixing_ = config.reduced_cost_fixing;
+  branching_ = config.branching;
+  chooseFormulation(config);
+  setParameters(config);
+  buildModel(config.model_cache);
+  if (config.user_cuts) {
+    cut_handler_ =
+      std::make_shared<CutSeparationHandler>(getInput(), observed_objects_);
+    addCallbackHandler(cut_handler_);
+  }
+  resetBranching();
+  if (config.heuristic_frequency > 0) {
+    addCallbackHandler(std::make_shared<RoundingHeuristicHandler>(
+      getInput(), variables_, config.heuristic_frequency,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::duration<double>(config.heuristic_time_box)
+      )
+    ));
+  }
+  setBuildTimeToOutput(getElapsedTime<std::chrono::milliseconds>());
+  setFixedColumnsToOutput((long)presolve_fixings_.size());
+}
+
+void OpsCplexSolver::chooseFormulation(const SolverConfig &config) {
+  formulation_ = config.formulation;
+  if (formulation_ != Formulation::kTimeIndexed &&
+      formulation_ != Formulation::kBySize) {
+    return;
+  }
+  const auto &input = getInput();
+  const int bucket_size =
+    config.time_bucket > 0
+      ? config.time_bucket
+      : TimeExpandedNetwork::getBucketSize(input, kMaxTimeIndexedColumns);
+  if (formulation_ == Formulation::kBySize) {
+    int shortest_arc = input.getTimeLimit();
+    for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+      for (const auto &arc : input.getGraph(k).getArcs()) {
+        const int time = input.getTimeToProcess(
+          {arc.getOriginId(), arc.getDestinationId()}
+        );
+        if (time > 0) { shortest_arc = std::min(shortest_arc, time); }
+      }
+    }
+    if (bucket_size > shortest_arc) {
+      formulation_ = Formulation::kMtz;
+      return;
+    }
+  }
+  formulation_ = Formulation::kTimeIndexed;
+  time_network_.emplace(input, bucket_size);
+}
+
+void OpsCplexSolver::buildModel(const std::string &model_cache) {
+  const AllocationScope allocation_scope(AllocationCategory::kModel);
+  // The bucket changes the columns of the time-indexed formulation
+  const auto formulation_name =
+    time_network_ ? std::format(
+                      "{}-b{}", toString(formulation_),
+                      time_network_->getBucketSize()
+                    )
+                  : std::string(toString(formulation_));
+  const auto model_path =
+    model_cache.empty()
+      ? fs::path()
+      : fs::path(model_cache) / std::format(
+                                  "{:016x}-v{}-{}{}.sav",
+                                  getInput().getContentHash(),
+                                  kFormulationVersion, formulation_name,
+                                  symmetry_breaking_ ? "" : "-nosym"
+                                );
+  const bool is_cached = !model_path.empty() && fs::exists(model_path);
+  {
+    const PhaseScope phase("model build");
+    if (is_cached) {
+      importModel(model_path);
+    } else {
+      makeModel();
+    }
+  }
+  std::vector<double> greedy_start;
+  if (reduced_cost_fixing_) {
+    const PhaseScope phase("presolve");
+    greedy_start = presolveModel();
+  }
+  {
+    const PhaseScope phase("extract");
+    cplex_.extract(model_);
+  }
+  if (!greedy_start.empty()) { addMipStart(greedy_start); }
+  // The fixings only hold for this input, so they are not saved
+  if (!model_path.empty() && !is_cached && !reduced_cost_fixing_) {
+    exportModel(model_path);
+  }
+}
+
+std::vector<double> OpsCplexSolver::presolveModel() {
+  const auto &input = getInput();
+  const auto greedy_values = toValues(input, buildGreedyPlan(input));
+  const double lower_bound = getPlanProfit(input, greedy_values);
+  const auto fix = [&](IloNumVar variable, const double value) {
+    variable.setBounds(value, value);
+    presolve_fixings_.push_back(variable);
+  };
+  const auto time_windows = TimeExpandedNetwork::computeTimeWindows(input);
+  const auto last_node_id = (unsigned int)input.getAmountOfObjects() - 1;
+  for (unsigned int object_id = 1; object_id < last_node_id; ++object_id) {
+    if (time_windows.earliest[object_id] > time_windows.latest[object_id]) {
+      fix(observed_objects_[object_id - 1], 0);
+    }
+  }
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      const auto origin_id = arc.getOriginId();
+      const auto destination_id = arc.getDestinationId();
+      const long arrival_time =
+        time_windows.earliest[origin_id] +
+        input.getTimeToProcess({origin_id, destination_id});
+      if (arrival_time > time_windows.latest[destination_id]) {
+        fix(used_arcs_[arc.getId()], 0);
+      }
+    }
+  }
+  // Moving a column away from its bound costs at least its reduced cost, so
+  // the columns that would cost more than the gap to the greedy plan are fixed
+  IloNumVarArray binaries(environment_);
+  binaries.add(observed_objects_);
+  binaries.add(used_arcs_);
+  IloNumArray values(environment_);
+  IloNumArray reduced_costs(environment_);
+  if (const auto bound = solveRelaxation(binaries, values, reduced_costs)) {
+    for (IloInt idx = 0; idx < binaries.getSize(); ++idx) {
+      const double value = values[idx];
+      const bool is_at_bound = value < kFixingTolerance ||
+                               value > 1 - kFixingTolerance;
+      if (binaries[idx].getLB() == binaries[idx].getUB() || !is_at_bound) {
+        continue;
+      }
+      if (*bound - std::abs(reduced_costs[idx]) <
+          lower_bound - kFixingTolerance) {
+        fix(binaries[idx], std::round(value));
+      }
+    }
+  }
+  values.end();
+  reduced_costs.end();
+  binaries.end();
+  return greedy_values;
+}
+
+void OpsCplexSolver::releasePresolveFixings() {
+  for (auto &variable : presolve_fixings_) { variable.setBounds(0, 1); }
+  presolve_fixings_.clear();
+}
+
+std::optional<double> OpsCplexSolver::solveRelaxation(
+  const IloNumVarArray &variables, IloNumArray &values,
+  IloNumArray &reduced_costs
+) const {
+  // A copy of the model, so the one extracted keeps its integer variables
+  IloModel relaxation(environment_);
+  relaxation.add(model_);
+  IloConversion relaxed_objects(
+    environment_, observed_objects_, IloNumVar::Float
+  );
+  IloConversion relaxed_arcs(environment_, used_arcs_, IloNumVar::Float);
+  relaxation.add(relaxed_objects);
+  relaxation.add(relaxed_arcs);
+  IloCplex cplex(relaxation);
+  cplex.setOut(environment_.getNullStream());
+  std::optional<double> bound;
+  if (cplex.solve()) {
+    bound = cplex.getObjValue();
+    if (variables.getSize() > 0) {
+      cplex.getValues(values, variables);
+      cplex.getReducedCosts(reduced_costs, variables);
+    }
+  }
+  cplex.end();
+  relaxation.end();
+  relaxed_objects.end();
+  relaxed_arcs.end();
+  return bound;
+}
+
+void OpsCplexSolver::importModel(const std::string &file_path) {
+  const auto &input = getInput();
+  IloObjective objective(environment_);
+  IloNumVarArray variables(environment_);
+  IloRangeArray constraints(environment_);
+  cplex_.importModel(
+    model_, file_path.c_str(), objective, variables, constraints
+  );
+  // The columns were saved in the order the variables were added to the
+  // model: y, s, x and then f (only in the time-flow formulation) or the
+  // network (only in the time-indexed formulation)
+  const IloInt amount_of_y = input.getAmountOfObjects() - 2;
+  const IloInt amount_of_s = input.getAmountOfObjects();
+  const auto amount_of_x = (IloInt)input.getAmountOfArcs();
+  const IloInt amount_of_f =
+    formulation_ == Formulation::kTimeFlow ? amount_of_x : 0;
+  const auto amount_of_network =
+    time_network_ ? (IloInt)time_network_->getAmountOfColumns() : 0;
+  const IloInt expected_columns =
+    amount_of_y + amount_of_s + amount_of_x + amount_of_f + amount_of_network;
+  if (variables.getSize() != expected_columns) {
+    const auto amount_of_columns = variables.getSize();
+    variables.end();
+    constraints.end();
+    throw OpsError(
+      "The saved model '{}' has {} columns instead of {}, remove it to "
+      "build the model again",
+      file_path, amount_of_columns, expected_columns
+    );
+  }
+  for (IloInt idx = 0; idx < variables.getSize(); ++idx) {
+    if (idx < amount_of_y) {
+      observed_objects_.add(variables[idx]);
+    } else if (idx < amount_of_y + amount_of_s) {
+      time_at_objects_.add(variables[idx]);
+    } else if (idx < amount_of_y + amount_of_s + amount_of_x) {
+      used_arcs_.add(variables[idx]);
+    } else if (amount_of_f > 0) {
+      time_flows_.add(variables[idx]);
+    } else {
+      time_buckets_.add(variables[idx]);
+    }
+  }
+  variables_.add(observed_objects_);
+  variables_.add(time_at_objects_);
+  variables_.add(used_arcs_);
+  objective_ = objective;
+  delta_plus_constraints_.resize(input.getAmountOfSlidingBars());
+  delta_minus_constraints_.resize(input.getAmountOfSlidingBars());
+  for (IloInt idx = 0; idx < constraints.getSize(); ++idx) {
+    registerConstraint(constraints[idx]);
+  }
+  variables.end();
+  constraints.end();
+}
+
+void OpsCplexSolver::registerConstraint(const IloRange &constraint) {
+  // The names were given by addDeltaPlusConstraints,
+  // addDeltaMinusConstraints and addSymmetryConstraints
+  unsigned int sliding_bar = 0;
+  unsigned int node_id = 0;
+  const char *const name = constraint.getName();
+  if (name == nullptr) { return; }
+  if (std::sscanf(name, "deltaplus_%u_%u", &sliding_bar, &node_id) == 2) {
+    delta_plus_constraints_.at(sliding_bar - 1).emplace(node_id, constraint);
+  } else if (std::sscanf(name, "deltaminus_%u_%u", &sliding_bar, &node_id) ==
+             2) {
+    delta_minus_constraints_.at(sliding_bar - 1).emplace(node_id, constraint);
+  } else if (unsigned int outer_sliding_bar = 0;
+             std::sscanf(
+               name, "symmetry_%u_%u", &sliding_bar, &outer_sliding_bar
+             ) == 2) {
+    symmetry_constraints_.emplace(sliding_bar - 1, constraint);
+    symmetry_constraints_.emplace(outer_sliding_bar - 1, constraint);
+  }
+}
+
+void OpsCplexSolver::relaxSymmetryConstraints(const int sliding_bar_idx) {
+  const auto [first, last] = symmetry_constraints_.equal_range(sliding_bar_idx);
+  for (auto iterator = first; iterator != last; ++iterator) {
+    iterator->second.setBounds(-IloInfinity, IloInfinity);
+  }
+  symmetry_constraints_.erase(first, last);
+}
+
+void OpsCplexSolver::keepSolutionAsMipStart() {
+  const auto status = cplex_.getStatus();
+  if (status != IloAlgorithm::Optimal && status != IloAlgorithm::Feasible) {
+    return;
+  }
+  IloNumArray values(environment_);
+  cplex_.getValues(values, variables_);
+  if (cplex_.getNMIPStarts() > 0) {
+    cplex_.deleteMIPStarts(0, cplex_.getNMIPStarts());
+  }
+  cplex_.addMIPStart(variables_, values, IloCplex::MIPStartRepair);
+  values.end();
+}
+
+void OpsCplexSolver::resetCutSeparation() {
+  if (!cut_handler_) { return; }
+  callback_.removeHandler(cut_handler_);
+  cut_handler_ =
+    std::make_shared<CutSeparationHandler>(getInput(), observed_objects_);
+  addCallbackHandler(cut_handler_);
+}
+
+void OpsCplexSolver::resetBranching() {
+  if (branching_ == Branching::kCplex) { return; }
+  const auto &input = getInput();
+  const auto amount_of_objects = input.getAmountOfObjects();
+  // The shortest time to reach each object, by any sliding bar
+  std::vector<int> shortest_times(amount_of_objects, input.getTimeLimit());
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      const auto destination_id = arc.getDestinationId();
+      shortest_times[destination_id] = std::min(
+        shortest_times[destination_id],
+        input.getTimeToProcess({arc.getOriginId(), destination_id})
+      );
+    }
+  }
+  const auto get_ratio = [&](const unsigned int object_id) {
+    return input.getPriority(object_id) /
+           (double)std::max(shortest_times[object_id], 1);
+  };
+  std::vector<unsigned int> objects(amount_of_objects - 2);
+  std::iota(objects.begin(), objects.end(), 1);
+  std::ranges::stable_sort(
+    objects,
+    [&](const unsigned int first, const unsigned int second) {
+      return get_ratio(first) < get_ratio(second);
+    }
+  );
+  // The arcs keep the priority 0, so every object is branched on before them
+  for (std::size_t rank = 0; rank < objects.size(); ++rank) {
+    const auto &observed_object = observed_objects_[objects[rank] - 1];
+    cplex_.setPriority(observed_object, (double)rank + 1);
+    cplex_.setDirection(observed_object, IloCplex::BranchUp);
+  }
+  if (branching_ != Branching::kAggregates) { return; }
+  if (branching_handler_) { callback_.removeHandler(branching_handler_); }
+  branching_handler_ =
+    std::make_shared<AggregateBranchingHandler>(input, observed_objects_);
+  addCallbackHandler(branching_handler_);
+}
+
+void OpsCplexSolver::checkSlidingBarObject(
+  const int sliding_bar_idx, const unsigned int object_id
+) const {
+  const auto &input = getInput();
+  if (sliding_bar_idx < 0 ||
+      (std::size_t)sliding_bar_idx >= input.getAmountOfSlidingBars()) {
+    throw OpsError(
+      "The sliding bar {} does not exist, there are {}", sliding_bar_idx,
+      input.getAmountOfSlidingBars()
+    );
+  }
+  checkObject(object_id);
+}
+
+void OpsCplexSolver::checkObject(const unsigned int object_id) const {
+  const auto amount_of_objects = getInput().getAmountOfObjects();
+  if (object_id == 0 || object_id >= amount_of_objects - 1) {
+    throw OpsError(
+      "The object {} does not exist, the objects go from 1 to {}", object_id,
+      amount_of_objects - 2
+    );
+  }
+}
+
+void OpsCplexSolver::checkReplanningFormulation() const {
+  if (formulation_ != Formulation::kMtz) {
+    throw OpsError(
+      "The sliding bars can only be changed with the mtz formulation, not "
+      "with {}",
+      toString(formulation_)
+    );
+  }
+}
+
+int OpsCplexSolver::getBigM() const {
+  const auto &input = getInput();
+  return std::max((int)input.getMaxArc(), input.getTimeLimit()) + 1;
+}
+
+void OpsCplexSolver::exportModel(const std::string &file_path) const {
+  // The format is deduced from the extension, so the temporary file keeps it
+  static std::atomic<unsigned> counter {0};
+  const auto temporary_path =
+    std::format("{}.{}-{}.sav", file_path, ::getpid(), ++counter);
+  try {
+    fs::create_directories(fs::path(file_path).parent_path());
+    cplex_.exportModel(temporary_path.c_str());
+    fs::rename(temporary_path, file_path);
+  } catch (const IloException &exception) {
+    std::cerr << "Cannot save the model: " << exception << '\n';
+  } catch (const fs::filesystem_error &exception) {
+    std::cerr << "Cannot save the model: " << exception.what() << '\n';
+  }
+}
+
+void OpsCplexSolver::endModel() {
+  // The variables, objective and constraints were added one by one to the
+  // model, so they can be collected from it
+  IloExtractableArray extractables(environment_);
+  for (IloModel::Iterator iterator(model_); iterator.ok(); ++iterator) {
+    extractables.add(*iterator);
+  }
+  cplex_.end();
+  model_.end();
+  extractables.endElements();
+  extractables.end();
+  used_arcs_.end();
+  observed_objects_.end();
+  time_at_objects_.end();
+  variables_.end();
+  time_flows_.end();
+  time_buckets_.end();
+}
+
 void OpsCplexSolver::makeModel() {
   addYVariable();
   addSVariable();
   addXVariable();
+  variables_.add(observed_objects_);
+  variables_.add(time_at_objects_);
+  variables_.add(used_arcs_);
+  // The flows are not part of the solution, CPLEX completes them from it
+  if (formulation_ == Formulation::kTimeFlow) { addFVariable(); }
+  if (formulation_ == Formulation::kTimeIndexed) { addTimeIndexedVariables(); }
   addObjective();
   addConstraints();
 }
@@ -120,6 +805,66 @@ void OpsCplexSolver::addXVariable() {
   model_.add(used_arcs_);
 }
 
+void OpsCplexSolver::addFVariable() {
+  const auto &input = getInput();
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto graph = input.getGraph(k);
+    for (const auto &arc : graph.getArcs()) {
+      const auto &origin_id = arc.getOriginId();
+      const auto &destination_id = arc.getDestinationId();
+      const auto latest_departure = std::max(
+        0, input.getTimeLimit() -
+             (int)input.getTimeToProcess({origin_id, destination_id})
+      );
+      time_flows_.add(IloNumVar(
+        environment_, 0, origin_id == 0 ? 0 : latest_departure,
+        IloNumVar::Float,
+        std::format("f_{}_{}_{}", k + 1, origin_id, destination_id).c_str()
+      ));
+    }
+  }
+  model_.add(time_flows_);
+}
+
+void OpsCplexSolver::addTimeIndexedVariables() {
+  const auto &input = getInput();
+  const auto &network = *time_network_;
+  // The names are given by column, since the arcs may not be in order
+  std::vector<std::string> names(network.getAmountOfColumns());
+  for (unsigned int object_id = 1; object_id < input.getAmountOfObjects() - 1;
+       ++object_id) {
+    const auto &buckets = network.getObservations(object_id);
+    for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+      names[network.getObservationColumn(object_id, bucket)] =
+        std::format("v_{}_{}", object_id, bucket);
+    }
+  }
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      const auto &buckets = network.getDepartures(arc.getId());
+      for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+        names[network.getDepartureColumn(arc.getId(), bucket)] = std::format(
+          "z_{}_{}_{}_{}", k + 1, arc.getOriginId(), arc.getDestinationId(),
+          bucket
+        );
+      }
+    }
+    for (const auto &object_id : input.getObjectsPerSlidingBar(k)) {
+      const auto &buckets = network.getObservations(object_id);
+      for (int bucket = buckets.first; bucket < buckets.last; ++bucket) {
+        names[network.getWaitingColumn(k, object_id, bucket)] =
+          std::format("w_{}_{}_{}", k + 1, object_id, bucket);
+      }
+    }
+  }
+  for (const auto &name : names) {
+    time_buckets_.add(
+      IloNumVar(environment_, 0, 1, IloNumVar::Float, name.c_str())
+    );
+  }
+  model_.add(time_buckets_);
+}
+
 void OpsCplexSolver::addObjective() {
   const auto &input = getInput();
   IloExpr expression(environment_);
@@ -127,16 +872,27 @@ void OpsCplexSolver::addObjective() {
        ++node_idx) {
     expression += input.getPriority(node_idx) * observed_objects_[node_idx - 1];
   }
-  model_.add(IloMaximize(environment_, expression));
+  objective_ = IloMaximize(environment_, expression);
+  model_.add(objective_);
   expression.end();
 }
 
 void OpsCplexSolver::addConstraints() {
   IloRangeArray constraints(environment_);
+  delta_plus_constraints_.resize(getInput().getAmountOfSlidingBars());
+  delta_minus_constraints_.resize(getInput().getAmountOfSlidingBars());
   addDeltaPlusConstraints(constraints);
   addDeltaMinusConstraints(constraints);
-  addMTZConstraints(constraints);
+  if (formulation_ == Formulation::kTimeFlow) {
+    addTimeFlowConstraints(constraints);
+  } else {
+    addMTZConstraints(constraints);
+  }
+  if (formulation_ == Formulation::kTimeIndexed) {
+    addTimeIndexedConstraints(constraints);
+  }
   addLimitConstraints(constraints);
+  if (symmetry_breaking_) { addSymmetryConstraints(constraints); }
   model_.add(constraints);
   constraints.end();
 }
@@ -152,10 +908,12 @@ void OpsCplexSolver::addDeltaPlusConstraints(IloRangeArray &constraints) {
       for (const auto &arc_id : arcs_id) { expression += used_arcs_[arc_id]; }
       if (origin_id != 0) { expression -= observed_objects_[origin_id - 1]; }
       const double is_root_node = origin_id == 0 ? 1.0 : 0.0;
-      constraints.add(IloRange(
+      const IloRange constraint(
         environment_, is_root_node, expression, is_root_node,
         std::format("deltaplus_{}_{}", k + 1, origin_id).c_str()
-      ));
+      );
+      constraints.add(constraint);
+      delta_plus_constraints_[k].emplace(origin_id, constraint);
       expression.end();
     }
   }
@@ -175,10 +933,12 @@ void OpsCplexSolver::addDeltaMinusConstraints(IloRangeArray &constraints) {
         expression -= observed_objects_[node_id - 1];
       }
       const double is_last_node = node_id == last_node_id ? 1.0 : 0.0;
-      constraints.add(IloRange(
+      const IloRange constraint(
         environment_, is_last_node, expression, is_last_node,
         std::format("deltaminus_{}_{}", k + 1, node_id).c_str()
-      ));
+      );
+      constraints.add(constraint);
+      delta_minus_constraints_[k].emplace(node_id, constraint);
       expression.end();
     }
   }
@@ -186,7 +946,7 @@ void OpsCplexSolver::addDeltaMinusConstraints(IloRangeArray &constraints) {
 
 void OpsCplexSolver::addMTZConstraints(IloRangeArray &constraints) {
   const auto &input = getInput();
-  const int BIG_M = std::max((int)input.getMaxArc(), input.getTimeLimit()) + 1;
+  const int BIG_M = getBigM();
   for (auto k = 0; k < input.getAmountOfSlidingBars(); ++k) {
     const auto &graph = input.getGraph(k);
     for (const auto &arc : graph.getArcs()) {
@@ -206,6 +966,192 @@ void OpsCplexSolver::addMTZConstraints(IloRangeArray &constraints) {
   }
 }
 
+void OpsCplexSolver::addTimeFlowConstraints(IloRangeArray &constraints) {
+  const auto &input = getInput();
+  const auto last_node_id = input.getAmountOfObjects() - 1;
+  std::vector<double> arc_times(input.getAmountOfArcs());
+  for (auto k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      arc_times[arc.getId()] = (double)input.getTimeToProcess(
+        {arc.getOriginId(), arc.getDestinationId()}
+      );
+    }
+  }
+  for (auto k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto &graph = input.getGraph(k);
+    for (const auto &arc : graph.getArcs()) {
+      const auto &origin_id = arc.getOriginId();
+      const auto &destination_id = arc.getDestinationId();
+      // The arcs of the first node leave at 0 (bounded by the variable)
+      if (origin_id == 0) { continue; }
+      const auto latest_departure =
+        input.getTimeLimit() - arc_times[arc.getId()];
+      IloExpr expression(environment_);
+      expression = time_flows_[arc.getId()] -
+                   std::max(0.0, latest_departure) * used_arcs_[arc.getId()];
+      constraints.add(IloRange(
+        environment_, -IloInfinity, expression, 0,
+        std::format("flowbound_{}_{}_{}", k + 1, origin_id, destination_id)
+          .c_str()
+      ));
+      expression.end();
+    }
+    for (const auto &node_id : graph.getNodesId()) {
+      if (node_id == 0) { continue; }
+      // Every sliding bar reaches the node before the time it is observed
+      IloExpr arrival_expression(environment_);
+      arrival_expression = time_at_objects_[node_id];
+      for (const auto &arc_id : graph.getPredecessorsArcsId(node_id)) {
+        arrival_expression -=
+          time_flows_[arc_id] + arc_times[arc_id] * used_arcs_[arc_id];
+      }
+      constraints.add(IloRange(
+        environment_, 0, arrival_expression, IloInfinity,
+        std::format("timeflow_{}_{}", k + 1, node_id).c_str()
+      ));
+      arrival_expression.end();
+      if (node_id == last_node_id) { continue; }
+      // And leaves it at that time. As every sliding bar that can observe
+      // the object goes through it when it is observed, the flow leaving it
+      // is the time of the object (or 0 if it is not observed)
+      IloExpr departure_expression(environment_);
+      departure_expression = time_at_objects_[node_id];
+      for (const auto &arc_id : graph.getSuccessorsArcsId(node_id)) {
+        departure_expression -= time_flows_[arc_id];
+      }
+      constraints.add(IloRange(
+        environment_, 0, departure_expression, 0,
+        std::format("timelink_{}_{}", k + 1, node_id).c_str()
+      ));
+      departure_expression.end();
+    }
+  }
+}
+
+void OpsCplexSolver::addTimeIndexedConstraints(IloRangeArray &constraints) {
+  const auto &input = getInput();
+  const auto &network = *time_network_;
+  const int bucket_size = network.getBucketSize();
+  const int big_m = getBigM();
+  for (unsigned int object_id = 1; object_id < input.getAmountOfObjects() - 1;
+       ++object_id) {
+    const auto &buckets = network.getObservations(object_id);
+    IloExpr observed_expression(environment_);
+    IloExpr start_expression(environment_);
+    IloExpr end_expression(environment_);
+    observed_expression -= observed_objects_[object_id - 1];
+    start_expression += time_at_objects_[object_id];
+    end_expression +=
+      time_at_objects_[object_id] + big_m * observed_objects_[object_id - 1];
+    for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+      const auto column = network.getObservationColumn(object_id, bucket);
+      const auto &observed_in_bucket = time_buckets_[(IloInt)column];
+      observed_expression += observed_in_bucket;
+      start_expression -= bucket * bucket_size * observed_in_bucket;
+      end_expression -= (bucket + 1) * bucket_size * observed_in_bucket;
+    }
+    // Objects without buckets cannot be observed in the night
+    constraints.add(IloRange(
+      environment_, 0, observed_expression, 0,
+      std::format("bucketobserve_{}", object_id).c_str()
+    ));
+    constraints.add(IloRange(
+      environment_, 0, start_expression, IloInfinity,
+      std::format("bucketstart_{}", object_id).c_str()
+    ));
+    constraints.add(IloRange(
+      environment_, -IloInfinity, end_expression, big_m,
+      std::format("bucketend_{}", object_id).c_str()
+    ));
+    observed_expression.end();
+    start_expression.end();
+    end_expression.end();
+  }
+  for (auto k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto &graph = input.getGraph(k);
+    // Arcs without buckets cannot be used
+    for (const auto &arc : graph.getArcs()) {
+      const auto &buckets = network.getDepartures(arc.getId());
+      IloExpr expression(environment_);
+      expression = used_arcs_[arc.getId()];
+      for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+        const auto column = network.getDepartureColumn(arc.getId(), bucket);
+        expression -= time_buckets_[(IloInt)column];
+      }
+      constraints.add(IloRange(
+        environment_, 0, expression, 0,
+        std::format(
+          "bucketlink_{}_{}_{}", k + 1, arc.getOriginId(),
+          arc.getDestinationId()
+        )
+          .c_str()
+      ));
+      expression.end();
+    }
+    for (const auto &object_id : input.getObjectsPerSlidingBar(k)) {
+      const auto &buckets = network.getObservations(object_id);
+      if (buckets.size() == 0) { continue; }
+      std::vector<IloExpr> leave_expressions;
+      std::vector<IloExpr> reach_expressions;
+      for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+        const auto column = network.getObservationColumn(object_id, bucket);
+        const auto &observed_in_bucket = time_buckets_[(IloInt)column];
+        leave_expressions.emplace_back(environment_);
+        leave_expressions.back() -= observed_in_bucket;
+        reach_expressions.emplace_back(environment_);
+        reach_expressions.back() -= observed_in_bucket;
+        // Waiting from the previous bucket and to the next one
+        if (bucket > buckets.first) {
+          const auto waiting_column =
+            network.getWaitingColumn(k, object_id, bucket - 1);
+          reach_expressions.back() += time_buckets_[(IloInt)waiting_column];
+        }
+        if (bucket < buckets.last) {
+          const auto waiting_column =
+            network.getWaitingColumn(k, object_id, bucket);
+          reach_expressions.back() -= time_buckets_[(IloInt)waiting_column];
+        }
+      }
+      for (const auto &arc_id : graph.getSuccessorsArcsId(object_id)) {
+        const auto &departures = network.getDepartures(arc_id);
+        for (int bucket = departures.first; bucket <= departures.last;
+             ++bucket) {
+          const auto column = network.getDepartureColumn(arc_id, bucket);
+          leave_expressions[bucket - buckets.first] +=
+            time_buckets_[(IloInt)column];
+        }
+      }
+      // Arriving before the first bucket means waiting until it
+      for (const auto &arc_id : graph.getPredecessorsArcsId(object_id)) {
+        const auto &departures = network.getDepartures(arc_id);
+        for (int bucket = departures.first; bucket <= departures.last;
+             ++bucket) {
+          const auto arrival = std::max(
+            bucket + network.getTravelBuckets(arc_id), buckets.first
+          );
+          const auto column = network.getDepartureColumn(arc_id, bucket);
+          reach_expressions[arrival - buckets.first] +=
+            time_buckets_[(IloInt)column];
+        }
+      }
+      for (int bucket = buckets.first; bucket <= buckets.last; ++bucket) {
+        auto &leave_expression = leave_expressions[bucket - buckets.first];
+        auto &reach_expression = reach_expressions[bucket - buckets.first];
+        constraints.add(IloRange(
+          environment_, 0, leave_expression, 0,
+          std::format("bucketleave_{}_{}_{}", k + 1, object_id, bucket).c_str()
+        ));
+        constraints.add(IloRange(
+          environment_, 0, reach_expression, 0,
+          std::format("bucketreach_{}_{}_{}", k + 1, object_id, bucket).c_str()
+        ));
+        leave_expression.end();
+        reach_expression.end();
+      }
+    }
+  }
+}
+
 void OpsCplexSolver::addLimitConstraints(IloRangeArray &constraints) {
   const auto &input = getInput();
   IloExpr start_time_expression(environment_);
@@ -223,15 +1169,64 @@ void OpsCplexSolver::addLimitConstraints(IloRangeArray &constraints) {
   end_time_expression.end();
 }
 
+void OpsCplexSolver::addSymmetryConstraints(IloRangeArray &constraints) {
+  const auto &input = getInput();
+  for (const auto &[inner_idx, outer_idx, are_equal] :
+       input.getNestedSlidingBars()) {
+    std::map<std::pair<unsigned int, unsigned int>, unsigned int> outer_arcs;
+    for (const auto &arc : input.getGraph(outer_idx).getArcs()) {
+      outer_arcs.emplace(
+        std::pair(arc.getOriginId(), arc.getDestinationId()), arc.getId()
+      );
+    }
+    for (const auto &arc : input.getGraph(inner_idx).getArcs()) {
+      const auto &origin_id = arc.getOriginId();
+      const auto &destination_id = arc.getDestinationId();
+      IloExpr expression(environment_);
+      expression = used_arcs_[arc.getId()] -
+                   used_arcs_[outer_arcs.at({origin_id, destination_id})];
+      const IloRange constraint(
+        environment_, 0, expression, are_equal ? 0 : IloInfinity,
+        std::format(
+          "symmetry_{}_{}_{}_{}", inner_idx + 1, outer_idx + 1, origin_id,
+          destination_id
+        )
+          .c_str()
+      );
+      constraints.add(constraint);
+      symmetry_constraints_.emplace(inner_idx, constraint);
+      symmetry_constraints_.emplace(outer_idx, constraint);
+      expression.end();
+    }
+  }
+}
+
 // -------------------------------- Setters -------------------------------- //
 
-void OpsCplexSolver::setParameters(const double tolerance) {
-  cplex_.setParam(IloCplex::Param::TimeLimit, OpsCplexSolver::kTimeLimit);
-  cplex_.setParam(IloCplex::Param::MIP::Tolerances::AbsMIPGap, tolerance);
+void OpsCplexSolver::setParameters(const SolverConfig &config) {
+  cplex_.setParam(IloCplex::Param::TimeLimit, config.time_limit);
+  cplex_.setParam(
+    IloCplex::Param::MIP::Tolerances::AbsMIPGap, config.tolerance
+  );
+  if (config.threads > 0) {
+    cplex_.setParam(IloCplex::Param::Threads, config.threads);
+  }
   cplex_.setParam(IloCplex::Param::Emphasis::MIP, CPX_MIPEMPHASIS_OPTIMALITY);
 }
 
 void OpsCplexSolver::setOutput(long time_elapsed) {
+  {
+    const PhaseScope phase("output");
+    setSolutionToOutput(time_elapsed);
+  }
+  // The phases are moved to the output, so they do not pile up when the
+  // same thread solves several models
+  setMemoryProfileToOutput(MemoryProfile::current());
+  MemoryProfile::current().clear();
+}
+
+void OpsCplexSolver::setSolutionToOutput(long time_elapsed) {
+  const AllocationScope allocation_scope(AllocationCategory::kOutput);
   const auto used_arcs = IloNumVarArrayToVector(used_arcs_);
   const auto visited_objects = IloNumVarArrayToVector(observed_objects_);
   auto time_at_objects = IloNumVarArrayToVector(time_at_objects_);
@@ -242,6 +1237,7 @@ void OpsCplexSolver::setOutput(long time_elapsed) {
   setObservedObjectsToOutput(visited_objects);
   setTimeAtObjectsToOutput(time_at_objects);
   setTimeSpentToOutput(time_elapsed);
+  setNodesToOutput(cplex_.getNnodes());
 }
 
 // -------------------------------- Utility -------------------------------- //
@@ -0,0 +1,241 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file plan.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the functions that move a
+ * plan from and to the values of a model, and of the greedy plan.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <ops_error.hpp>
+#include <ops_input.hpp>
+#include <plan.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+namespace {
+
+// Gets how much an object is wanted after the last node of each sliding bar.
+using AffinityFunction = std::function<
+  double(std::size_t object_id, const std::vector<std::size_t> &last_nodes)>;
+
+// The affinity of an object the relaxation does not observe, so it is only
+// added once the ones it observes do not fit.
+constexpr double kMinAffinity = 1e-3;
+
+/**
+ * @brief Builds a feasible plan in the order the objects are observed. Each
+ * step observes the object with the most priority per unit of time waited by
+ * the sliding bars that can observe it (times its affinity), which go to it
+ * from their last object and still reach the last node in time.
+ *
+ * @param input The input of the model.
+ * @param get_affinity Gets how much each object is wanted.
+ * @param deadline The moment the plan stops growing.
+ */
+Plan buildPlan(
+  const OpsInput &input, const AffinityFunction &get_affinity,
+  const std::chrono::steady_clock::time_point deadline
+) {
+  const auto amount_of_objects = input.getAmountOfObjects();
+  const auto amount_of_sliding_bars = input.getAmountOfSlidingBars();
+  const auto last_node_id = amount_of_objects - 1;
+  const long time_limit = input.getTimeLimit();
+  // The sliding bars that can observe each object
+  std::vector<std::vector<std::size_t>> sliding_bars_per_object(
+    amount_of_objects
+  );
+  for (std::size_t k = 0; k < amount_of_sliding_bars; ++k) {
+    for (const auto &object_id : input.getObjectsPerSlidingBar(k)) {
+      sliding_bars_per_object[object_id].push_back(k);
+    }
+  }
+  Plan plan {
+    .routes = std::vector<std::vector<unsigned int>>(amount_of_sliding_bars),
+    .times = std::vector<double>(amount_of_objects, 0.0)
+  };
+  // The last node and its time of each sliding bar
+  std::vector<std::size_t> last_nodes(amount_of_sliding_bars, 0);
+  std::vector<long> end_times(amount_of_sliding_bars, 0);
+  std::vector<bool> is_observed(amount_of_objects, false);
+  while (std::chrono::steady_clock::now() < deadline) {
+    std::optional<std::size_t> best_object;
+    long best_time = 0;
+    double best_score = 0;
+    for (std::size_t object_id = 1; object_id < last_node_id; ++object_id) {
+      const auto &sliding_bars = sliding_bars_per_object[object_id];
+      if (is_observed[object_id] || sliding_bars.empty()) { continue; }
+      long time = 0;
+      for (const auto &k : sliding_bars) {
+        const long arrival_time =
+          end_times[k] + input.getTimeToProcess({last_nodes[k], object_id});
+        time = std::max(time, arrival_time);
+      }
+      const auto finish_time =
+        time + input.getTimeToProcess({object_id, last_node_id});
+      if (finish_time > time_limit) { continue; }
+      long waited_time = 0;
+      for (const auto &k : sliding_bars) { waited_time += time - end_times[k]; }
+      const auto score = get_affinity(object_id, last_nodes) *
+                         input.getPriority(object_id) /
+                         (double)(1 + waited_time);
+      if (!best_object || score > best_score) {
+        best_object = object_id;
+        best_time = time;
+        best_score = score;
+      }
+    }
+    if (!best_object) { break; }
+    is_observed[*best_object] = true;
+    plan.times[*best_object] = (double)best_time;
+    for (const auto &k : sliding_bars_per_object[*best_object]) {
+      plan.routes[k].push_back((unsigned int)*best_object);
+      last_nodes[k] = *best_object;
+      end_times[k] = best_time;
+    }
+  }
+  long finish_time = 0;
+  for (std::size_t k = 0; k < amount_of_sliding_bars; ++k) {
+    finish_time = std::max(
+      finish_time,
+      end_times[k] + input.getTimeToProcess({last_nodes[k], last_node_id})
+    );
+  }
+  plan.times[last_node_id] = (double)finish_time;
+  return plan;
+}
+
+}  // namespace
+
+std::size_t getFirstTimeIdx(const OpsInput &input) {
+  return input.getAmountOfObjects() - 2;
+}
+
+std::size_t getFirstArcIdx(const OpsInput &input) {
+  return getFirstTimeIdx(input) + input.getAmountOfObjects();
+}
+
+Plan readPlan(const OpsInput &input, const std::vector<double> &values) {
+  const auto first_arc_idx = getFirstArcIdx(input);
+  const auto last_node_id = (unsigned int)input.getAmountOfObjects() - 1;
+  Plan plan {
+    .routes = std::vector<std::vector<unsigned int>>(
+      input.getAmountOfSlidingBars()
+    ),
+    .times = std::vector<double>(
+      values.begin() + (long)getFirstTimeIdx(input),
+      values.begin() + (long)first_arc_idx
+    )
+  };
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    std::map<unsigned int, unsigned int> next_node;
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      if (values[first_arc_idx + arc.getId()] > 0.5) {
+        next_node[arc.getOriginId()] = arc.getDestinationId();
+      }
+    }
+    auto node_id = next_node.at(0);
+    while (node_id != last_node_id) {
+      plan.routes[k].push_back(node_id);
+      node_id = next_node.at(node_id);
+    }
+  }
+  return plan;
+}
+
+std::vector<double> toValues(const OpsInput &input, const Plan &plan) {
+  const auto first_time_idx = getFirstTimeIdx(input);
+  const auto first_arc_idx = getFirstArcIdx(input);
+  const auto last_node_id = (unsigned int)input.getAmountOfObjects() - 1;
+  std::vector<double> values(first_arc_idx + input.getAmountOfArcs(), 0.0);
+  std::ranges::copy(plan.times, values.begin() + (long)first_time_idx);
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    unsigned int origin_id = 0;
+    const auto use_arc = [&](const unsigned int destination_id) {
+      const auto arc_id = input.getGraph(k).getArcId(
+        {.origin_id = origin_id, .destination_id = destination_id}
+      );
+      if (!arc_id) {
+        throw OpsError(
+          "The sliding bar {} has no arc from {} to {}", k, origin_id,
+          destination_id
+        );
+      }
+      values[first_arc_idx + *arc_id] = 1;
+      origin_id = destination_id;
+    };
+    for (const auto &object_id : plan.routes[k]) {
+      values[object_id - 1] = 1;
+      use_arc(object_id);
+    }
+    use_arc(last_node_id);
+  }
+  return values;
+}
+
+double getPlanProfit(const OpsInput &input, const std::vector<double> &values) {
+  double profit = 0;
+  for (std::size_t idx = 0; idx < getFirstTimeIdx(input); ++idx) {
+    profit += values[idx] * input.getPriority(idx + 1);
+  }
+  return profit;
+}
+
+Plan buildGreedyPlan(const OpsInput &input) {
+  return buildPlan(
+    input, [](std::size_t, const std::vector<std::size_t> &) { return 1.0; },
+    std::chrono::steady_clock::time_point::max()
+  );
+}
+
+Plan buildGuidedPlan(
+  const OpsInput &input, const std::vector<double> &values,
+  const std::chrono::steady_clock::time_point deadline
+) {
+  const auto first_arc_idx = getFirstArcIdx(input);
+  return buildPlan(
+    input,
+    [&](const std::size_t object_id, const std::vector<std::size_t> &last_nodes
+    ) {
+      double affinity = kMinAffinity + values[object_id - 1];
+      for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+        const auto arc_id = input.getGraph(k).getArcId(
+          {.origin_id = (unsigned int)last_nodes[k],
+           .destination_id = (unsigned int)object_id}
+        );
+        if (arc_id) { affinity += values[first_arc_idx + *arc_id]; }
+      }
+      return affinity;
+    },
+    deadline
+  );
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,60 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file progress_trace_handler.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the callback handler that
+ * records the progress of the search in the trace.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <cmath>
+
+#include <progress_trace_handler.hpp>
+#include <trace.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+namespace {
+
+// CPLEX reports values beyond this one when there is no incumbent yet.
+constexpr double kInfinity = 1e70;
+
+}  // namespace
+
+void ProgressTraceHandler::invoke(const IloCplex::Callback::Context &context) {
+  using Info = IloCplex::Callback::Context::Info;
+  const double bound = context.getDoubleInfo(Info::BestBound);
+  const double incumbent = context.getDoubleInfo(Info::BestSolution);
+  if (std::abs(bound) < kInfinity) {
+    OPS_TRACE_COUNTER("bound", {{"bound", bound}});
+  }
+  if (std::abs(incumbent) >= kInfinity) { return; }
+  OPS_TRACE_COUNTER("incumbent", {{"incumbent", incumbent}});
+  if (std::abs(bound) < kInfinity) {
+    OPS_TRACE_COUNTER(
+      "gap",
+      {{"gap", std::abs(bound - incumbent) / (1e-10 + std::abs(incumbent))}}
+    );
+  }
+}
+
+}  // namespace emir
+
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
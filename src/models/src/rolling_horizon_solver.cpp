@@ -0,0 +1,265 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file rolling_horizon_solver.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the solver that plans the
+ * night in overlapping windows of time.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <ops_cplex_solver.hpp>
+#include <ops_error.hpp>
+#include <ops_input.hpp>
+#include <plan.hpp>
+#include <rolling_horizon_solver.hpp>
+#include <time_expanded_network.hpp>
+#include <trace.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+RollingHorizonSolver::RollingHorizonSolver(
+  OpsInput &&input, const SolverConfig &solver_config,
+  const RollingHorizonConfig &config
+) :
+  OpsSolver(std::move(input)), solver_config_ {solver_config},
+  config_ {config} {
+  if (config_.windows < 1) {
+    throw OpsError("There must be at least 1 window, not {}", config_.windows);
+  }
+  if (config_.overlap < 0 || config_.overlap >= 1) {
+    throw OpsError(
+      "The overlap must be between 0 and 1, not {}", config_.overlap
+    );
+  }
+  if (config_.polish_fraction < 0 || config_.polish_fraction >= 1) {
+    throw OpsError(
+      "The polish fraction must be between 0 and 1, not {}",
+      config_.polish_fraction
+    );
+  }
+}
+
+RollingHorizonSolver::RollingHorizonSolver(
+  OpsInput &&input, const SolverConfig &solver_config,
+  const RollingHorizonConfig &config, const IloEnv &environment
+) :
+  RollingHorizonSolver(std::move(input), solver_config, config) {
+  environment_ = environment;
+}
+
+void RollingHorizonSolver::solve() {
+  resetTimer();
+  const auto &input = getInput();
+  const auto amount_of_objects = input.getAmountOfObjects();
+  const int time_limit = input.getTimeLimit();
+  const double window_length = (double)time_limit / config_.windows;
+  const auto amount_of_candidates = getAmountOfCandidates(window_length);
+  auto window_config = solver_config_;
+  window_config.time_limit = solver_config_.time_limit *
+                             (1 - config_.polish_fraction) / config_.windows;
+  // The models of the windows depend on the plan, so they are not reused
+  window_config.model_cache.clear();
+  // Nothing is observed at first, every sliding bar goes to the last object
+  Plan plan {
+    .routes = std::vector<std::vector<unsigned int>>(
+      input.getAmountOfSlidingBars()
+    ),
+    .times = std::vector<double>(amount_of_objects, 0.0)
+  };
+  std::vector<bool> is_fixed(amount_of_objects, false);
+  std::vector<bool> is_offered(amount_of_objects, false);
+  const auto time_windows = TimeExpandedNetwork::computeTimeWindows(input);
+  long nodes = 0;
+  long build_time = 0;
+  for (int window = 0; window < config_.windows; ++window) {
+    OPS_TRACE_SPAN(std::format("window {}", window + 1));
+    const bool is_last_window = window + 1 == config_.windows;
+    const double window_end = window_length * (window + 1);
+    const int horizon =
+      is_last_window
+        ? time_limit
+        : std::min(
+            time_limit,
+            (int)std::lround(window_end + config_.overlap * window_length)
+          );
+    std::vector<bool> is_planned(amount_of_objects, false);
+    for (const auto &route : plan.routes) {
+      for (const auto &object_id : route) { is_planned[object_id] = true; }
+    }
+    const OpsInput window_input(input.restrictTo(
+      selectObjects(
+        is_planned, is_offered, time_windows, window_length * window,
+        amount_of_candidates
+      ),
+      horizon
+    ));
+    const auto window_solver =
+      createSolver(OpsInput(window_input), window_config);
+    for (unsigned int object_id = 1; object_id < amount_of_objects - 1;
+         ++object_id) {
+      if (is_fixed[object_id]) {
+        window_solver->fixObject(object_id, plan.times[object_id]);
+      }
+    }
+    // The plan of the previous window still fits, since the horizon grows
+    window_solver->addMipStart(toValues(window_input, plan));
+    window_solver->solve();
+    build_time += window_solver->getOutput().getBuildTime();
+    // Without a solution the plan is kept, the next window has more time
+    if (window_solver->getOutput().getTimeSpent() < 0) { continue; }
+    nodes += window_solver->getOutput().getNodes();
+    plan = readPlan(window_input, window_solver->getSolutionValues());
+    for (const auto &route : plan.routes) {
+      for (const auto &object_id : route) {
+        if (plan.times[object_id] < window_end) { is_fixed[object_id] = true; }
+      }
+    }
+  }
+  auto values = toValues(input, plan);
+  const double time_left =
+    solver_config_.time_limit -
+    (double)getElapsedTime<std::chrono::milliseconds>() / 1000;
+  if (config_.polish_fraction > 0 && time_left >= 1) {
+    OPS_TRACE_SPAN("polish");
+    auto polish_config = solver_config_;
+    polish_config.time_limit = time_left;
+    const auto polish_solver = createSolver(OpsInput(input), polish_config);
+    polish_solver->addMipStart(values);
+    polish_solver->solve();
+    build_time += polish_solver->getOutput().getBuildTime();
+    if (polish_solver->getOutput().getTimeSpent() >= 0) {
+      nodes += polish_solver->getOutput().getNodes();
+      if (polish_solver->getProfit() >= getPlanProfit(input, values)) {
+        values = polish_solver->getSolutionValues();
+      }
+    }
+  }
+  setBuildTimeToOutput(build_time);
+  setSolutionToOutput(values, nodes);
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+std::unique_ptr<OpsCplexSolver> RollingHorizonSolver::createSolver(
+  OpsInput &&input, const SolverConfig &config
+) const {
+  auto solver = environment_ ? std::make_unique<OpsCplexSolver>(
+                                 std::move(input), config, *environment_
+                               )
+                             : std::make_unique<OpsCplexSolver>(
+                                 std::move(input), config
+                               );
+  if (log_stream_ != nullptr) { solver->addLog(*log_stream_); }
+  return solver;
+}
+
+std::size_t
+RollingHorizonSolver::getAmountOfCandidates(const double window_length) const {
+  if (config_.objects_per_window > 0) { return config_.objects_per_window; }
+  const auto &input = getInput();
+  const auto amount_of_objects = input.getAmountOfObjects();
+  double total_time = 0;
+  std::size_t amount_of_pairs = 0;
+  for (std::size_t origin_id = 1; origin_id < amount_of_objects - 1;
+       ++origin_id) {
+    for (std::size_t destination_id = 1;
+         destination_id < amount_of_objects - 1; ++destination_id) {
+      if (origin_id == destination_id) { continue; }
+      total_time += input.getTimeToProcess({origin_id, destination_id});
+      ++amount_of_pairs;
+    }
+  }
+  if (amount_of_pairs == 0 || total_time <= 0) {
+    return amount_of_objects - 2;
+  }
+  // Twice the objects that fit in a window, so CPLEX has where to choose
+  const double mean_time = total_time / (double)amount_of_pairs;
+  return std::max<std::size_t>(
+    1, 2 * (std::size_t)std::ceil(window_length / mean_time)
+  );
+}
+
+std::vector<unsigned int> RollingHorizonSolver::selectObjects(
+  const std::vector<bool> &is_planned, std::vector<bool> &is_offered,
+  const TimeExpandedNetwork::TimeWindows &time_windows,
+  const double window_start, const std::size_t amount_of_candidates
+) const {
+  const auto &input = getInput();
+  std::vector<unsigned int> objects;
+  std::vector<unsigned int> candidates;
+  for (unsigned int object_id = 1; object_id < input.getAmountOfObjects() - 1;
+       ++object_id) {
+    if (is_planned[object_id]) {
+      objects.push_back(object_id);
+    } else if (!is_offered[object_id] ||
+               (double)time_windows.latest[object_id] > window_start) {
+      candidates.push_back(object_id);
+    }
+  }
+  const auto amount = std::min(amount_of_candidates, candidates.size());
+  std::ranges::partial_sort(
+    candidates, candidates.begin() + (long)amount,
+    [&](const unsigned int first, const unsigned int second) {
+      return input.getPriority(first) > input.getPriority(second) ||
+             (input.getPriority(first) == input.getPriority(second) &&
+              first < second);
+    }
+  );
+  for (std::size_t idx = 0; idx < amount; ++idx) {
+    objects.push_back(candidates[idx]);
+    is_offered[candidates[idx]] = true;
+  }
+  return objects;
+}
+
+void RollingHorizonSolver::setSolutionToOutput(
+  const std::vector<double> &values, const long nodes
+) {
+  const auto &input = getInput();
+  const auto first_time_idx = (long)getFirstTimeIdx(input);
+  const auto first_arc_idx = (long)getFirstArcIdx(input);
+  const std::vector<double> observed_objects(
+    values.begin(), values.begin() + first_time_idx
+  );
+  std::vector<double> time_at_objects(
+    values.begin() + first_time_idx, values.begin() + first_arc_idx
+  );
+  for (std::size_t idx = 1; idx + 1 < time_at_objects.size(); ++idx) {
+    time_at_objects[idx] *= observed_objects[idx - 1];
+  }
+  setUsedArcsToOutput({values.begin() + first_arc_idx, values.end()});
+  setObservedObjectsToOutput(observed_objects);
+  setTimeAtObjectsToOutput(time_at_objects);
+  setTimeSpentToOutput(getElapsedTime<std::chrono::milliseconds>());
+  setNodesToOutput(nodes);
+  checkOutput();
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,81 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file rounding_heuristic_handler.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the handler that rounds the
+ * relaxation of the nodes into feasible plans.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <ops_input.hpp>
+#include <plan.hpp>
+#include <rounding_heuristic_handler.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+RoundingHeuristicHandler::RoundingHeuristicHandler(
+  const OpsInput &input, const IloNumVarArray &variables, const long frequency,
+  const std::chrono::microseconds time_box
+) :
+  input_ {input}, variables_ {variables},
+  frequency_ {std::max(frequency, 1L)}, time_box_ {time_box} {}
+
+void RoundingHeuristicHandler::invoke(
+  const IloCplex::Callback::Context &context
+) {
+  using Info = IloCplex::Callback::Context::Info;
+  // Only the thread that takes the turn runs, the others skip the node
+  const long node = context.getLongInfo(Info::NodeCount);
+  long next_node = next_node_.load();
+  if (node < next_node ||
+      !next_node_.compare_exchange_strong(next_node, node + frequency_)) {
+    return;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + time_box_;
+  IloNumArray relaxation(context.getEnv());
+  context.getRelaxationPoint(variables_, relaxation);
+  std::vector<double> values(relaxation.getSize());
+  for (IloInt idx = 0; idx < relaxation.getSize(); ++idx) {
+    values[idx] = relaxation[idx];
+  }
+  relaxation.end();
+  const auto plan_values =
+    toValues(input_, buildGuidedPlan(input_, values, deadline));
+  const double profit = getPlanProfit(input_, plan_values);
+  if (context.getIntInfo(Info::Feasible) != 0 &&
+      profit <= context.getIncumbentObjective() + kMinImprovement) {
+    return;
+  }
+  IloNumArray solution(context.getEnv());
+  for (const auto value : plan_values) { solution.add(value); }
+  // The columns of the other formulations are completed by CPLEX
+  context.postHeuristicSolution(
+    variables_, solution, profit,
+    IloCplex::Callback::Context::SolutionStrategy::SolveFixed
+  );
+  solution.end();
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,50 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file solver_callback.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the generic callback used by
+ * the CPLEX solver.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <solver_callback.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+CPXLONG SolverCallback::getContextMask() const {
+  CPXLONG context_mask = 0;
+  for (const auto &handler : handlers_) {
+    context_mask |= handler->getContextMask();
+  }
+  return context_mask;
+}
+
+void SolverCallback::invoke(const IloCplex::Callback::Context &context) {
+  const auto context_id = context.getId();
+  for (const auto &handler : handlers_) {
+    if ((handler->getContextMask() & context_id) != 0) {
+      handler->invoke(context);
+    }
+  }
+}
+
+}  // namespace emir
+
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -0,0 +1,74 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file solver_config.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the conversions of the options of the CPLEX solver.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <solver_config.hpp>
+
+namespace emir {
+
+Formulation formulationFromString(const std::string_view name) {
+  if (name == "mtz") { return Formulation::kMtz; }
+  if (name == "time-flow") { return Formulation::kTimeFlow; }
+  if (name == "time-indexed") { return Formulation::kTimeIndexed; }
+  if (name == "by-size") { return Formulation::kBySize; }
+  throw std::invalid_argument("Unknown formulation: " + std::string(name));
+}
+
+std::string_view toString(const Formulation formulation) {
+  switch (formulation) {
+    case Formulation::kMtz:
+      return "mtz";
+    case Formulation::kTimeFlow:
+      return "time-flow";
+    case Formulation::kTimeIndexed:
+      return "time-indexed";
+    case Formulation::kBySize:
+      return "by-size";
+  }
+  return "unknown";
+}
+
+Branching branchingFromString(const std::string_view name) {
+  if (name == "cplex") { return Branching::kCplex; }
+  if (name == "priorities") { return Branching::kPriorities; }
+  if (name == "aggregates") { return Branching::kAggregates; }
+  throw std::invalid_argument("Unknown branching: " + std::string(name));
+}
+
+std::string_view toString(const Branching branching) {
+  switch (branching) {
+    case Branching::kCplex:
+      return "cplex";
+    case Branching::kPriorities:
+      return "priorities";
+    case Branching::kAggregates:
+      return "aggregates";
+  }
+  return "unknown";
+}
+
+}  // namespace emir
\ No newline at end of file
@@ -0,0 +1,202 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file time_expanded_network.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the time-expanded network of
+ * the sliding bars.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex * @endlink
+ * @see Selective routing problem with synchronization @link https://www.sciencedirect.com/science/article/pii/S0305054821002161?ref=cra_js_challenge&fr=RR-1 @endlink
+ * @see EMIR Telescope @link https://www.gtc.iac.es/instruments/emir/ @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <ops_input.hpp>
+#include <time_expanded_network.hpp>
+
+// NOLINTBEGIN(misc-include-cleaner)
+namespace emir {
+
+namespace {
+
+// Distance between two nodes without a path between them.
+constexpr long kUnreachable = std::numeric_limits<long>::max() / 4;
+
+}  // namespace
+
+TimeExpandedNetwork::TimeExpandedNetwork(
+  const OpsInput &input, const int bucket_size
+) :
+  TimeExpandedNetwork(input, computeTimeWindows(input), bucket_size) {}
+
+TimeExpandedNetwork::TimeExpandedNetwork(
+  const OpsInput &input, const TimeWindows &time_windows,
+  const int bucket_size
+) :
+  bucket_size_ {std::max(bucket_size, 1)} {
+  computeObservations(time_windows);
+  computeDepartures(input, time_windows);
+  computeColumns(input);
+}
+
+int TimeExpandedNetwork::getBucketSize(
+  const OpsInput &input, const std::size_t max_columns
+) {
+  const auto time_windows = computeTimeWindows(input);
+  int bucket_size = 1;
+  while (bucket_size < input.getTimeLimit() &&
+         TimeExpandedNetwork(input, time_windows, bucket_size)
+             .getAmountOfColumns() > max_columns) {
+    bucket_size *= 2;
+  }
+  return bucket_size;
+}
+
+TimeExpandedNetwork::TimeWindows
+TimeExpandedNetwork::computeTimeWindows(const OpsInput &input) {
+  const auto amount_of_objects = input.getAmountOfObjects();
+  const auto last_node_id = (unsigned int)amount_of_objects - 1;
+  const auto time_limit = (long)input.getTimeLimit();
+  TimeWindows time_windows {
+    .earliest = std::vector<long>(amount_of_objects, 0),
+    .latest = std::vector<long>(amount_of_objects, time_limit)
+  };
+  time_windows.latest[0] = 0;
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    const auto &objects = input.getObjectsPerSlidingBar(k);
+    // The nodes of the sliding bar: the first one, its objects and the last
+    // one
+    std::vector<unsigned int> nodes {0};
+    nodes.insert(nodes.end(), objects.begin(), objects.end());
+    nodes.push_back(last_node_id);
+    const auto amount_of_nodes = nodes.size();
+    const auto last_idx = amount_of_nodes - 1;
+    std::vector<std::vector<long>> distances(
+      amount_of_nodes, std::vector<long>(amount_of_nodes, kUnreachable)
+    );
+    for (std::size_t origin = 0; origin < last_idx; ++origin) {
+      distances[origin][origin] = 0;
+      for (std::size_t destination = 1; destination < amount_of_nodes;
+           ++destination) {
+        if (origin == destination) { continue; }
+        distances[origin][destination] =
+          input.getTimeToProcess({nodes[origin], nodes[destination]});
+      }
+    }
+    for (std::size_t middle = 1; middle < last_idx; ++middle) {
+      for (std::size_t origin = 0; origin < last_idx; ++origin) {
+        for (std::size_t destination = 1; destination < amount_of_nodes;
+             ++destination) {
+          distances[origin][destination] = std::min(
+            distances[origin][destination],
+            distances[origin][middle] + distances[middle][destination]
+          );
+        }
+      }
+    }
+    // Every sliding bar that can observe an object goes through it when it
+    // is observed, so its window is the intersection of all of them
+    for (std::size_t idx = 1; idx < last_idx; ++idx) {
+      auto &earliest = time_windows.earliest[nodes[idx]];
+      auto &latest = time_windows.latest[nodes[idx]];
+      earliest = std::max(earliest, distances[0][idx]);
+      latest = std::min(latest, time_limit - distances[idx][last_idx]);
+    }
+  }
+  return time_windows;
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+void TimeExpandedNetwork::computeObservations(const TimeWindows &time_windows
+) {
+  observations_.reserve(time_windows.earliest.size());
+  for (std::size_t node_id = 0; node_id < time_windows.earliest.size();
+       ++node_id) {
+    const auto earliest = time_windows.earliest[node_id];
+    const auto latest = time_windows.latest[node_id];
+    const auto first = (int)(earliest / bucket_size_);
+    observations_.push_back(
+      {.first = first,
+       .last = latest < earliest ? first - 1 : (int)(latest / bucket_size_)}
+    );
+  }
+}
+
+void TimeExpandedNetwork::computeDepartures(
+  const OpsInput &input, const TimeWindows &time_windows
+) {
+  const auto amount_of_arcs = input.getAmountOfArcs();
+  const auto last_node_id = (unsigned int)input.getAmountOfObjects() - 1;
+  departures_.assign(amount_of_arcs, {.first = 0, .last = -1});
+  travel_buckets_.assign(amount_of_arcs, 0);
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &arc : input.getGraph(k).getArcs()) {
+      const auto origin_id = arc.getOriginId();
+      const auto destination_id = arc.getDestinationId();
+      const long time = input.getTimeToProcess({origin_id, destination_id});
+      travel_buckets_[arc.getId()] = (int)(time / bucket_size_);
+      const auto &origin_buckets = observations_[origin_id];
+      if (destination_id != last_node_id &&
+          observations_[destination_id].size() == 0) {
+        continue;
+      }
+      // Leaving later would reach the destination after its window
+      const auto latest_departure =
+        time_windows.latest[destination_id] - time;
+      if (latest_departure < 0) { continue; }
+      departures_[arc.getId()] = {
+        .first = origin_buckets.first,
+        .last = std::min(
+          origin_buckets.last, (int)(latest_departure / bucket_size_)
+        )
+      };
+    }
+  }
+}
+
+void TimeExpandedNetwork::computeColumns(const OpsInput &input) {
+  const auto amount_of_objects = input.getAmountOfObjects();
+  observation_columns_.assign(amount_of_objects, 0);
+  for (std::size_t object_id = 1; object_id < amount_of_objects - 1;
+       ++object_id) {
+    observation_columns_[object_id] = amount_of_columns_;
+    amount_of_columns_ += (std::size_t)observations_[object_id].size();
+  }
+  departure_columns_.assign(departures_.size(), 0);
+  for (std::size_t arc_id = 0; arc_id < departures_.size(); ++arc_id) {
+    departure_columns_[arc_id] = amount_of_columns_;
+    amount_of_columns_ += (std::size_t)departures_[arc_id].size();
+  }
+  waiting_columns_.assign(
+    input.getAmountOfSlidingBars(),
+    std::vector<std::size_t>(amount_of_objects, 0)
+  );
+  for (int k = 0; k < input.getAmountOfSlidingBars(); ++k) {
+    for (const auto &object_id : input.getObjectsPerSlidingBar(k)) {
+      waiting_columns_[k][object_id] = amount_of_columns_;
+      amount_of_columns_ +=
+        (std::size_t)std::max(observations_[object_id].size() - 1, 0);
+    }
+  }
+}
+
+}  // namespace emir
+// NOLINTEND(misc-include-cleaner)
\ No newline at end of file
@@ -28,6 +28,7 @@
 
 #include <memory>
 
+#include <memory.hpp>
 #include <ops_input.hpp>
 
 namespace emir {
@@ -86,6 +87,73 @@ class OpsOutput {
     time_elapsed_ = time_spent;
   }
 
+  /**
+   * @brief Set the amount of branch and bound nodes explored by the solver.
+   *
+   * @param nodes The amount of nodes explored.
+   */
+  void setNodes(const long nodes) {
+    nodes_ = nodes;
+  }
+
+  /**
+   * @brief Set the time spent to build the model before solving it.
+   *
+   * @param build_time The time spent to build the model.
+   */
+  void setBuildTime(const long build_time) {
+    build_time_ = build_time;
+  }
+
+  /**
+   * @brief Set the amount of columns fixed before solving the model.
+   *
+   * @param fixed_columns The amount of columns fixed.
+   */
+  void setFixedColumns(const long fixed_columns) {
+    fixed_columns_ = fixed_columns;
+  }
+
+  /**
+   * @brief Set the memory used at each phase to get the solution.
+   *
+   * @param memory_profile The profile with the memory used at each phase.
+   */
+  void setMemoryProfile(const MemoryProfile &memory_profile) {
+    memory_phases_ = memory_profile.getPhases();
+  }
+
+  // ------------------------------ Getters -------------------------------- //
+
+  /**
+   * @brief Gets the value of the solution.
+   * @details To calculate the objective value of the solution we need to sum
+   * the priority of the objects visited in the solution.
+   *
+   * @return The value of the solution.
+   */
+  [[nodiscard]] long getTotalProfit() const;
+
+  /** @brief Gets the time spent to solve the problem. */
+  [[nodiscard]] long getTimeSpent() const {
+    return time_elapsed_;
+  }
+
+  /** @brief Gets the amount of branch and bound nodes explored. */
+  [[nodiscard]] long getNodes() const {
+    return nodes_;
+  }
+
+  /** @brief Gets the time spent to build the model. */
+  [[nodiscard]] long getBuildTime() const {
+    return build_time_;
+  }
+
+  /** @brief Gets the amount of columns fixed before solving the model. */
+  [[nodiscard]] long getFixedColumns() const {
+    return fixed_columns_;
+  }
+
   // ------------------------------- Checks ------------------------------- //
 
   /**
@@ -139,6 +207,14 @@ class OpsOutput {
   std::vector<double> time_at_objects_;
   // The time elapsed to solve the problem.
   long time_elapsed_ {-1};
+  // The amount of branch and bound nodes explored by the solver.
+  long nodes_ {-1};
+  // The time elapsed to build the model.
+  long build_time_ {-1};
+  // The amount of columns fixed before solving the model.
+  long fixed_columns_ {0};
+  // The memory used at the end of each phase to get the solution.
+  std::vector<PhaseMemory> memory_phases_;
 
   // ------------------------------ Getters -------------------------------- //
 
@@ -155,15 +231,6 @@ class OpsOutput {
            arc_endpoints.destination_id;
   }
 
-  /**
-   * @brief Gets the value of the solution.
-   * @details To calculate the objective value of the solution we need to sum
-   * the priority of the objects visited in the solution.
-   *
-   * @return The value of the solution.
-   */
-  [[nodiscard]] long getTotalProfit() const;
-
   // --------------------------- Utility methods --------------------------- //
 
   /**
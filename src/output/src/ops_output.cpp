@@ -29,22 +29,25 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <functions.hpp>
 #include <graph.hpp>
+#include <memory.hpp>
 #include <ops_error.hpp>
 #include <ops_input.hpp>
 #include <ops_output.hpp>
 
 namespace emir {
 
-OpsOutput::OpsOutput(const OpsInput &input) :
-  input_(std::make_unique<OpsInput>(input)),
-  used_arcs_(input.getAmountOfSlidingBars()),
-  observed_objects_(input.getAmountOfObjects(), false),
-  time_at_objects_(input.getAmountOfObjects(), 0) {
+OpsOutput::OpsOutput(const OpsInput &input) {
+  const AllocationScope allocation_scope(AllocationCategory::kOutput);
+  input_ = std::make_unique<OpsInput>(input);
+  used_arcs_.resize(input.getAmountOfSlidingBars());
+  observed_objects_.assign(input.getAmountOfObjects(), false);
+  time_at_objects_.assign(input.getAmountOfObjects(), 0);
   for (auto &used_arc : used_arcs_) {
     used_arc.resize(input.getAmountOfObjects());
   }
@@ -116,21 +119,47 @@ void OpsOutput::setTimeAtObjects(const std::vector<double> &time_at_objects) {
 
 OpsOutput &OpsOutput::operator=(const OpsOutput &output) {
   if (this == &output) { return *this; }
+  const AllocationScope allocation_scope(AllocationCategory::kOutput);
   input_ = std::make_unique<OpsInput>(*output.input_);
   used_arcs_ = output.used_arcs_;
   observed_objects_ = output.observed_objects_;
   time_at_objects_ = output.time_at_objects_;
   time_elapsed_ = output.time_elapsed_;
+  nodes_ = output.nodes_;
+  build_time_ = output.build_time_;
+  fixed_columns_ = output.fixed_columns_;
+  memory_phases_ = output.memory_phases_;
   return *this;
 }
 
 std::ostream &operator<<(std::ostream &output_stream, const OpsOutput &output) {
+  auto memory = nlohmann::json::array();
+  for (const auto &phase_memory : output.memory_phases_) {
+    nlohmann::json allocated_kb;
+    for (std::size_t idx = 0; idx < kAllocationCategories; ++idx) {
+      const auto category = static_cast<AllocationCategory>(idx);
+      allocated_kb[std::string(getCategoryName(category))] = {
+        {"live", phase_memory.allocations[idx].live_bytes / 1024},
+        {"peak", phase_memory.allocations[idx].peak_bytes / 1024}
+      };
+    }
+    memory.push_back(
+      {{"phase", phase_memory.phase},
+       {"peak_rss_kb", phase_memory.peak_rss_kb},
+       {"rss_kb", phase_memory.rss_kb},
+       {"allocated_kb", allocated_kb}}
+    );
+  }
   return output_stream << nlohmann::json(
                             {{"x", output.used_arcs_},
                              {"y", output.observed_objects_},
                              {"s", output.time_at_objects_},
                              {"profit", output.getTotalProfit()},
-                             {"time_elapsed", output.time_elapsed_}}
+                             {"time_elapsed", output.time_elapsed_},
+                             {"nodes", output.nodes_},
+                             {"build_time", output.build_time_},
+                             {"fixed_columns", output.fixed_columns_},
+                             {"memory", memory}}
          ).dump(2);
 }
 
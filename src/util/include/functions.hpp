@@ -26,6 +26,7 @@
 
 #include <ctime>
 #include <fstream>
+#include <memory>
 
 #include <local_type_traits.hpp>
 #include <ops_solver.hpp>
@@ -64,16 +65,19 @@ Readable createFromFile(const std::string &file_name) {
  * O.P.S input.
  * @param tolerance The maximum tolerance to be used in the solver.
  * @param log_os The outflow where the logs will be stored.
- * @return The solver used to solve the problem.
+ * @return The solver used to solve the problem, which owns CPLEX objects and
+ * can not be copied.
  */
 template <typename Solver>
 requires std::is_base_of_v<emir::OpsSolver, Solver>
-Solver solve(
+std::unique_ptr<Solver> solve(
   const std::string &input_path, const double tolerance, std::ostream &log_os
 ) {
-  Solver solver(createFromFile<emir::OpsInput>(input_path), tolerance);
-  solver.addLog(log_os);
-  solver.solve();
+  auto solver = std::make_unique<Solver>(
+    createFromFile<emir::OpsInput>(input_path), tolerance
+  );
+  solver->addLog(log_os);
+  solver->solve();
   return solver;
 }
 
@@ -0,0 +1,118 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file hash.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing a FNV-1a hasher, used to get a canonical hash of the
+ * content of an instance that does not depend on the platform.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see FNV hash: @link http://www.isthe.com/chongo/tech/comp/fnv/index.html @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+
+/** @brief Computes the 64 bits FNV-1a hash of the values added to it. */
+class Fnv1aHasher {
+ public:
+  /**
+   * @brief Adds an integer, byte by byte from the least significant one, so
+   * the hash does not depend on the endianness.
+   *
+   * @param value The integer to add.
+   */
+  Fnv1aHasher &add(const std::integral auto value) {
+    auto bits = static_cast<std::uint64_t>(value);
+    for (std::size_t byte = 0; byte < sizeof(value); ++byte) {
+      addByte(static_cast<std::uint8_t>(bits & 0xFFU));
+      bits >>= 8U;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Adds a real number through its bit representation.
+   *
+   * @param value The real number to add.
+   */
+  Fnv1aHasher &add(const double value) {
+    return add(std::bit_cast<std::uint64_t>(value));
+  }
+
+  /**
+   * @brief Adds a text, preceded by its length.
+   *
+   * @param text The text to add.
+   */
+  Fnv1aHasher &add(const std::string_view text) {
+    add(text.size());
+    for (const auto character : text) {
+      addByte(static_cast<std::uint8_t>(character));
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Adds every element of a range, preceded by its length, so nested
+   * ranges with the same elements hash differently.
+   *
+   * @param range The range to add.
+   */
+  template <std::ranges::sized_range Range>
+  Fnv1aHasher &add(const Range &range) {
+    add(std::ranges::size(range));
+    for (const auto &value : range) { add(value); }
+    return *this;
+  }
+
+  /** @brief Gets the hash of the values added so far. */
+  [[nodiscard]] std::uint64_t getHash() const {
+    return hash_;
+  }
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The initial value of the hash.
+  static constexpr std::uint64_t kOffsetBasis = 0xCBF29CE484222325ULL;
+  // The prime each byte is multiplied by.
+  static constexpr std::uint64_t kPrime = 0x100000001B3ULL;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The hash of the values added so far.
+  std::uint64_t hash_ = kOffsetBasis;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Adds a single byte to the hash.
+   *
+   * @param byte The byte to add.
+   */
+  void addByte(const std::uint8_t byte) {
+    hash_ ^= byte;
+    hash_ *= kPrime;
+  }
+};
+
+#endif  // HASH_HPP_
\ No newline at end of file
@@ -0,0 +1,285 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file log_sink.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the sinks where the log of the
+ * solver can be written to. Every sink uses a bounded amount of memory, no
+ * matter how long the log is.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef LOG_SINK_HPP_
+#define LOG_SINK_HPP_
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/** @brief The ways the log of the solver can be handled. */
+enum class LogMode : std::uint8_t {
+  kDiscard,
+  kRing,
+  kFile,
+  kProgress,
+};
+
+/**
+ * @brief Gets the log mode with the given name.
+ *
+ * @param name The name of the mode (discard, ring, file or progress).
+ * @throw std::invalid_argument If there is no mode with that name.
+ */
+LogMode logModeFromString(std::string_view name);
+
+/**
+ * @brief Stream buffer that hands the text written to it in chunks of fixed
+ * size. Each sink decides what to do with those chunks.
+ */
+class LogSink : public std::streambuf {
+ public:
+  /** @brief Creates the sink with an empty buffer. */
+  LogSink();
+
+  /** @brief Destroy the LogSink object. */
+  ~LogSink() override = default;
+
+  LogSink(const LogSink &) = delete;
+  LogSink(LogSink &&) = delete;
+  LogSink &operator=(const LogSink &) = delete;
+  LogSink &operator=(LogSink &&) = delete;
+
+  /** @brief Gets a stream that writes into the sink. */
+  [[nodiscard]] std::ostream &getStream() {
+    return stream_;
+  }
+
+ protected:
+  /**
+   * @brief Handles a chunk of the log.
+   *
+   * @param text The chunk of the log.
+   */
+  virtual void consume(std::string_view text) = 0;
+
+  /** @brief Hands the buffered text to the sink. */
+  int sync() override;
+
+  /**
+   * @brief Hands the buffered text to the sink when the buffer is full.
+   *
+   * @param character The character that did not fit in the buffer.
+   */
+  int_type overflow(int_type character) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The size of the buffer used before handing the text to the sink.
+  static constexpr std::size_t kBufferSize = 4096;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The text written and not handed to the sink yet.
+  std::array<char, kBufferSize> buffer_ {};
+  // The stream that writes into the sink.
+  std::ostream stream_;
+};
+
+/** @brief Sink that throws away the log. */
+class DiscardLogSink : public LogSink {
+ protected:
+  void consume(std::string_view /*text*/) override {}
+};
+
+/**
+ * @brief Sink that keeps only the last bytes of the log, so they can be shown
+ * when something goes wrong.
+ */
+class RingLogSink : public LogSink {
+ public:
+  /**
+   * @brief Creates the sink.
+   *
+   * @param capacity The amount of bytes of the log to keep.
+   */
+  explicit RingLogSink(std::size_t capacity = kDefaultCapacity);
+
+  /** @brief Gets the last bytes of the log, in the order they were written. */
+  [[nodiscard]] std::string getContents();
+
+ protected:
+  void consume(std::string_view text) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The amount of bytes kept by default (64 KiB).
+  static constexpr std::size_t kDefaultCapacity = 64 * 1024;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The bytes kept, used as a circular buffer.
+  std::vector<char> ring_;
+  // The position where the next byte will be written.
+  std::size_t head_ = 0;
+  // Whether the buffer has been filled at least once.
+  bool full_ = false;
+};
+
+/**
+ * @brief Sink that writes the log to a file from a background thread, so the
+ * solver never waits for the disk. If the disk cannot keep up, the text that
+ * does not fit in the pending buffer is dropped and counted.
+ */
+class FileLogSink : public LogSink {
+ public:
+  /**
+   * @brief Opens the file and starts the writer thread.
+   *
+   * @param file_path The path to the file where the log is written.
+   */
+  explicit FileLogSink(const std::string &file_path);
+
+  /** @brief Writes the pending text and stops the writer thread. */
+  ~FileLogSink() override;
+
+  FileLogSink(const FileLogSink &) = delete;
+  FileLogSink(FileLogSink &&) = delete;
+  FileLogSink &operator=(const FileLogSink &) = delete;
+  FileLogSink &operator=(FileLogSink &&) = delete;
+
+  /** @brief Gets the amount of bytes dropped because the disk was too slow. */
+  [[nodiscard]] std::size_t getDroppedBytes();
+
+ protected:
+  void consume(std::string_view text) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The maximum amount of bytes waiting to be written (1 MiB).
+  static constexpr std::size_t kMaxPendingBytes = 1024 * 1024;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The file where the log is written.
+  std::ofstream file_;
+  // The text waiting to be written.
+  std::string pending_;
+  // The text being written by the writer thread.
+  std::string writing_;
+  // The amount of bytes dropped.
+  std::size_t dropped_bytes_ = 0;
+  // Whether the writer thread must finish.
+  bool stopping_ = false;
+  // Protects the pending text and the flags.
+  std::mutex mutex_;
+  // Wakes up the writer thread when there is text to write.
+  std::condition_variable pending_condition_;
+  // The thread that writes to the file.
+  std::thread writer_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /** @brief Writes the pending text until the sink is stopped. */
+  void writeLoop();
+};
+
+/** @brief A line of the node log of CPLEX. */
+struct ProgressRecord {
+  // Nodes processed so far.
+  long nodes;
+  // Nodes left to process.
+  long nodes_left;
+  // Objective value of the best integer solution (NaN if there is none).
+  double incumbent;
+  // Best bound of the objective value.
+  double bound;
+  // Relative gap between the incumbent and the bound (NaN if unknown).
+  double gap;
+};
+
+/**
+ * @brief Sink that parses the node log of CPLEX into progress records and
+ * throws away the rest of the text. Only the last records are kept.
+ */
+class ProgressLogSink : public LogSink {
+ public:
+  /**
+   * @brief Creates the sink.
+   *
+   * @param capacity The amount of records to keep.
+   */
+  explicit ProgressLogSink(std::size_t capacity = kDefaultCapacity);
+
+  /** @brief Gets the records kept, in the order they were written. */
+  [[nodiscard]] std::vector<ProgressRecord> getRecords();
+
+ protected:
+  void consume(std::string_view text) override;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The amount of records kept by default.
+  static constexpr std::size_t kDefaultCapacity = 1024;
+  // The maximum length of a line, longer ones are not node log lines.
+  static constexpr std::size_t kMaxLineLength = 256;
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The records kept, used as a circular buffer.
+  std::vector<ProgressRecord> records_;
+  // The maximum amount of records kept.
+  std::size_t capacity_;
+  // The position where the next record will be written.
+  std::size_t head_ = 0;
+  // The part of the current line written so far.
+  std::string line_;
+  // Whether the current line is too long to be parsed.
+  bool skipping_line_ = false;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Parses a line and keeps it if it is a node log line.
+   *
+   * @param line The line to parse.
+   */
+  void parseLine(std::string_view line);
+};
+
+/**
+ * @brief Creates the sink of the given mode.
+ *
+ * @param mode The way the log is handled.
+ * @param file_path The path to the file used by the file mode.
+ */
+std::unique_ptr<LogSink>
+createLogSink(LogMode mode, const std::string &file_path);
+
+#endif  // LOG_SINK_HPP_
\ No newline at end of file
@@ -0,0 +1,156 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file memory.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of the memory instrumentation.
+ * It records the resident set size high-water mark at each phase boundary and
+ * counts the allocations made through the global operator new, attributing
+ * them to the category of the scope that made them. Allocations made by
+ * CPLEX (through malloc) are not counted, so they are the resident set size
+ * minus the counted bytes.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef MEMORY_HPP_
+#define MEMORY_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/** @brief Categories where our own allocations are attributed to. */
+enum class AllocationCategory : std::uint8_t {
+  kOther,
+  kInput,
+  kGraphs,
+  kModel,
+  kOutput,
+};
+
+// The amount of allocation categories.
+constexpr std::size_t kAllocationCategories = 5;
+
+/**
+ * @brief Gets the name of an allocation category.
+ *
+ * @param category The category to get the name from.
+ */
+std::string_view getCategoryName(AllocationCategory category);
+
+/** @brief Bytes allocated through operator new by a category. */
+struct AllocationStats {
+  // Bytes allocated and not released yet.
+  long long live_bytes;
+  // Maximum amount of live bytes reached.
+  long long peak_bytes;
+};
+
+/**
+ * @brief Gets the allocation stats of a category.
+ * @details The counters are shared by every thread of the process, and they
+ * stay at zero unless the project is configured with ENABLE_MEMORY_PROFILING.
+ *
+ * @param category The category to get the stats from.
+ */
+AllocationStats getAllocationStats(AllocationCategory category);
+
+/**
+ * @brief Attributes every allocation made by the current thread to the given
+ * category while the scope is alive. Scopes can be nested, the innermost one
+ * is the one used.
+ */
+class AllocationScope {
+ public:
+  /**
+   * @brief Starts attributing the allocations to the given category.
+   *
+   * @param category The category of the allocations.
+   */
+  explicit AllocationScope(AllocationCategory category);
+
+  /** @brief Restores the category of the enclosing scope. */
+  ~AllocationScope();
+
+  AllocationScope(const AllocationScope &) = delete;
+  AllocationScope(AllocationScope &&) = delete;
+  AllocationScope &operator=(const AllocationScope &) = delete;
+  AllocationScope &operator=(AllocationScope &&) = delete;
+
+ private:
+  // The category of the enclosing scope.
+  AllocationCategory previous_category_;
+};
+
+/** @brief Memory used by the process at the end of a phase. */
+struct PhaseMemory {
+  // Name of the phase.
+  std::string phase;
+  // Resident set size high-water mark reached during the phase (in KiB).
+  long peak_rss_kb;
+  // Resident set size at the end of the phase (in KiB).
+  long rss_kb;
+  // Stats of each allocation category at the end of the phase.
+  std::array<AllocationStats, kAllocationCategories> allocations;
+};
+
+/**
+ * @brief Records the memory used at each phase boundary of the instance being
+ * processed by the current thread.
+ * @details The high-water mark is reset after each phase (when the kernel
+ * allows it), so each phase reports its own peak. The resident set size is
+ * shared by every thread of the process, so the mark is not reset while
+ * several instances are processed at once, and each phase reports the peak of
+ * the process instead.
+ */
+class MemoryProfile {
+ public:
+  /** @brief Gets the profile of the current thread. */
+  static MemoryProfile &current();
+
+  /**
+   * @brief Sets whether several instances are processed at once by the
+   * process.
+   *
+   * @param concurrent Whether several instances are processed at once.
+   */
+  static void setConcurrent(bool concurrent);
+
+  /** @brief Removes the recorded phases and resets the high-water mark. */
+  void clear();
+
+  /**
+   * @brief Records the memory used by the phase that has just finished.
+   *
+   * @param phase The name of the phase.
+   */
+  void markPhase(std::string_view phase);
+
+  /** @brief Gets the recorded phases, in the order they finished. */
+  [[nodiscard]] const std::vector<PhaseMemory> &getPhases() const {
+    return phases_;
+  }
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The recorded phases.
+  std::vector<PhaseMemory> phases_;
+};
+
+#endif  // MEMORY_HPP_
\ No newline at end of file
@@ -0,0 +1,71 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file phase.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description and implementation of a phase of the
+ * pipeline (parse, graph build, model build, extract, solve and output). A
+ * phase records the memory used at its end and, when tracing is enabled, a
+ * span with its duration.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef PHASE_HPP_
+#define PHASE_HPP_
+
+#include <string>
+#include <utility>
+
+#include <memory.hpp>
+#include <trace.hpp>
+
+/** @brief Measures a phase of the pipeline from its creation to its end. */
+class PhaseScope {
+ public:
+  /**
+   * @brief Starts the phase.
+   *
+   * @param name The name of the phase.
+   */
+  explicit PhaseScope(std::string name) :
+#ifdef OPS_ENABLE_TRACING
+    span_ {name},
+#endif
+    name_ {std::move(name)} {
+  }
+
+  /** @brief Records the memory used by the phase, if it is profiled. */
+  ~PhaseScope() {
+#ifdef OPS_ENABLE_MEMORY_PROFILING
+    MemoryProfile::current().markPhase(name_);
+#endif
+  }
+
+  PhaseScope(const PhaseScope &) = delete;
+  PhaseScope(PhaseScope &&) = delete;
+  PhaseScope &operator=(const PhaseScope &) = delete;
+  PhaseScope &operator=(PhaseScope &&) = delete;
+
+ private:
+#ifdef OPS_ENABLE_TRACING
+  // The span of the phase in the trace.
+  TraceSpan span_;
+#endif
+  // The name of the phase.
+  std::string name_;
+};
+
+#endif  // PHASE_HPP_
\ No newline at end of file
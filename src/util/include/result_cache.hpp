@@ -0,0 +1,107 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file result_cache.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of an on-disk cache of results,
+ * indexed by a key. It can be shared by several processes: entries are
+ * published with an atomic rename and the eviction is serialized with a file
+ * lock.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef RESULT_CACHE_HPP_
+#define RESULT_CACHE_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/** @brief Limits of the space used by the cache. */
+struct ResultCacheLimits {
+  // Maximum amount of bytes used by the entries.
+  std::uintmax_t max_bytes;
+  // Entries not used for longer than this are removed.
+  std::chrono::seconds max_age;
+};
+
+/**
+ * @brief Stores results in a directory, one file per key.
+ * @details Reading an entry refreshes its modification time, so the eviction
+ * removes the least recently used entries first.
+ */
+class ResultCache {
+ public:
+  /**
+   * @brief Creates the cache, and its directory if it does not exist.
+   *
+   * @param directory The directory where the entries are stored.
+   * @param limits The limits of the space used by the cache.
+   */
+  ResultCache(std::filesystem::path directory, ResultCacheLimits limits);
+
+  /**
+   * @brief Gets the result stored with the given key.
+   *
+   * @param key The key of the result.
+   * @return The result, or nothing if it is not stored or has expired.
+   */
+  [[nodiscard]] std::optional<std::string> load(std::string_view key) const;
+
+  /**
+   * @brief Stores a result and evicts the entries over the limits. Failing to
+   * store the result is not an error, it will just be computed again.
+   *
+   * @param key The key of the result.
+   * @param result The result to store.
+   */
+  void store(std::string_view key, std::string_view result) const;
+
+  /**
+   * @brief Removes the expired entries and then the least recently used ones
+   * until the limits are met.
+   */
+  void evict() const;
+
+ private:
+  // --------------------------- Static Constants -------------------------- //
+
+  // The extension of the entries.
+  static constexpr std::string_view kEntryExtension = ".json";
+  // The name of the file used to serialize the eviction.
+  static constexpr std::string_view kLockFileName = ".lock";
+
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The directory where the entries are stored.
+  std::filesystem::path directory_;
+  // The limits of the space used by the cache.
+  ResultCacheLimits limits_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /**
+   * @brief Gets the path to the entry with the given key.
+   *
+   * @param key The key of the entry.
+   */
+  [[nodiscard]] std::filesystem::path getEntryPath(std::string_view key) const;
+};
+
+#endif  // RESULT_CACHE_HPP_
\ No newline at end of file
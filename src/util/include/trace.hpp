@@ -0,0 +1,169 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file trace.hpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the description of a recorder of Chrome trace events
+ * (viewable in Perfetto or chrome://tracing), with spans for each phase and
+ * counter tracks.
+ * The instrumentation points are the OPS_TRACE_* macros, which compile away
+ * to nothing unless the project is configured with -DENABLE_TRACING=ON.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Trace event format: @link https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+#include <chrono>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/** @brief Collects the trace events of every thread of the process. */
+class TraceRecorder {
+ public:
+  /** @brief Gets the recorder of the process. */
+  static TraceRecorder &instance();
+
+  /**
+   * @brief Starts recording events, which will be written to the given file.
+   *
+   * @param output_path The path to the file where the trace will be written.
+   */
+  void enable(std::string output_path);
+
+  /** @brief Tells if the events are being recorded. */
+  [[nodiscard]] bool isEnabled() const {
+    return !output_path_.empty();
+  }
+
+  /** @brief Gets the microseconds elapsed since the recorder was created. */
+  [[nodiscard]] long long now() const;
+
+  /**
+   * @brief Adds a span that has already finished.
+   *
+   * @param name The name of the span.
+   * @param start The moment the span started (in microseconds).
+   * @param duration The duration of the span (in microseconds).
+   */
+  void addSpan(std::string_view name, long long start, long long duration);
+
+  /**
+   * @brief Adds a sample to a counter track.
+   *
+   * @param name The name of the track.
+   * @param values The name and value of each series of the track.
+   */
+  void addCounter(
+    std::string_view name,
+    std::initializer_list<std::pair<std::string_view, double>> values
+  );
+
+  /**
+   * @brief Names the track of the current thread.
+   *
+   * @param name The name of the thread.
+   */
+  void setThreadName(std::string_view name);
+
+  /** @brief Writes the events recorded to the output file. */
+  void flush();
+
+ private:
+  // ----------------------------- Attributes ------------------------------ //
+
+  // The path to the file where the trace will be written.
+  std::string output_path_;
+  // The moment the recorder was created.
+  std::chrono::steady_clock::time_point start_ {
+    std::chrono::steady_clock::now()
+  };
+  // The events recorded, already serialized.
+  std::vector<std::string> events_;
+  // Protects the events from concurrent writes.
+  std::mutex mutex_;
+
+  // --------------------------- Private Methods --------------------------- //
+
+  /** @brief Creates the recorder. */
+  TraceRecorder() = default;
+
+  /**
+   * @brief Adds an event if the recorder is enabled.
+   *
+   * @param event The event serialized as JSON.
+   */
+  void addEvent(std::string event);
+};
+
+/** @brief Records a span from its creation to its destruction. */
+class TraceSpan {
+ public:
+  /**
+   * @brief Starts the span.
+   *
+   * @param name The name of the span.
+   */
+  explicit TraceSpan(std::string name);
+
+  /** @brief Finishes the span and records it. */
+  ~TraceSpan();
+
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan(TraceSpan &&) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+  TraceSpan &operator=(TraceSpan &&) = delete;
+
+ private:
+  // The name of the span.
+  std::string name_;
+  // The moment the span started (in microseconds).
+  long long start_;
+};
+
+// ------------------------ Instrumentation points ------------------------- //
+
+#ifdef OPS_ENABLE_TRACING
+
+#define OPS_TRACE_CONCAT_IMPL(first, second) first##second
+#define OPS_TRACE_CONCAT(first, second) OPS_TRACE_CONCAT_IMPL(first, second)
+
+// Records a span until the end of the enclosing scope.
+#define OPS_TRACE_SPAN(name)                                                   \
+  const TraceSpan OPS_TRACE_CONCAT(trace_span_, __LINE__)(name)
+
+// Adds a sample to a counter track.
+#define OPS_TRACE_COUNTER(name, ...)                                           \
+  TraceRecorder::instance().addCounter(name, __VA_ARGS__)
+
+// Names the track of the current thread.
+#define OPS_TRACE_THREAD_NAME(name)                                            \
+  TraceRecorder::instance().setThreadName(name)
+
+#else
+
+#define OPS_TRACE_SPAN(name) static_cast<void>(0)
+#define OPS_TRACE_COUNTER(name, ...) static_cast<void>(0)
+#define OPS_TRACE_THREAD_NAME(name) static_cast<void>(0)
+
+#endif  // OPS_ENABLE_TRACING
+
+#endif  // TRACE_HPP_
\ No newline at end of file
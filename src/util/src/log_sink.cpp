@@ -0,0 +1,287 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file log_sink.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the sinks where the log of the
+ * solver can be written to.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <log_sink.hpp>
+
+namespace {
+
+/**
+ * @brief Splits a line in the words separated by blanks.
+ *
+ * @param line The line to split.
+ */
+std::vector<std::string_view> splitWords(const std::string_view line) {
+  std::vector<std::string_view> words;
+  std::size_t start = 0;
+  while (start < line.size()) {
+    start = line.find_first_not_of(" \t\r", start);
+    if (start == std::string_view::npos) { break; }
+    const auto end = std::min(line.find_first_of(" \t\r", start), line.size());
+    words.push_back(line.substr(start, end - start));
+    start = end;
+  }
+  return words;
+}
+
+/**
+ * @brief Parses a node counter of the log, which may be followed by a '+'.
+ *
+ * @param word The word to parse.
+ * @param value Where the value is stored.
+ * @return Whether the whole word is a node counter.
+ */
+bool parseNodeCounter(std::string_view word, long &value) {
+  if (word.ends_with('+')) { word.remove_suffix(1); }
+  const auto *const end = word.data() + word.size();
+  const auto [pointer, error] = std::from_chars(word.data(), end, value);
+  return error == std::errc() && pointer == end;
+}
+
+/**
+ * @brief Parses a real number of the log, which is always printed with a
+ * decimal point (integers are counters, not values of the objective).
+ *
+ * @param word The word to parse.
+ * @param value Where the value is stored.
+ * @return Whether the whole word is a real number.
+ */
+bool parseValue(const std::string_view word, double &value) {
+  if (word.find('.') == std::string_view::npos) { return false; }
+  const auto *const end = word.data() + word.size();
+  const auto [pointer, error] = std::from_chars(word.data(), end, value);
+  return error == std::errc() && pointer == end;
+}
+
+}  // namespace
+
+LogMode logModeFromString(const std::string_view name) {
+  if (name == "discard") { return LogMode::kDiscard; }
+  if (name == "ring") { return LogMode::kRing; }
+  if (name == "file") { return LogMode::kFile; }
+  if (name == "progress") { return LogMode::kProgress; }
+  throw std::invalid_argument("Unknown log mode: " + std::string(name));
+}
+
+// -------------------------------- Log sink -------------------------------- //
+
+LogSink::LogSink() : stream_(this) {
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+int LogSink::sync() {
+  consume(std::string_view(pbase(), pptr()));
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  return 0;
+}
+
+LogSink::int_type LogSink::overflow(const int_type character) {
+  sync();
+  if (!traits_type::eq_int_type(character, traits_type::eof())) {
+    sputc(traits_type::to_char_type(character));
+  }
+  return traits_type::not_eof(character);
+}
+
+// ------------------------------ Ring log sink ----------------------------- //
+
+RingLogSink::RingLogSink(const std::size_t capacity) : ring_(capacity) {}
+
+std::string RingLogSink::getContents() {
+  pubsync();
+  if (!full_) { return {ring_.begin(), ring_.begin() + (long)head_}; }
+  std::string contents(ring_.begin() + (long)head_, ring_.end());
+  contents.append(ring_.begin(), ring_.begin() + (long)head_);
+  return contents;
+}
+
+void RingLogSink::consume(std::string_view text) {
+  if (ring_.empty()) { return; }
+  if (text.size() > ring_.size()) {
+    text.remove_prefix(text.size() - ring_.size());
+  }
+  while (!text.empty()) {
+    const auto amount = std::min(text.size(), ring_.size() - head_);
+    std::copy_n(text.begin(), amount, ring_.begin() + (long)head_);
+    text.remove_prefix(amount);
+    head_ += amount;
+    if (head_ == ring_.size()) {
+      head_ = 0;
+      full_ = true;
+    }
+  }
+}
+
+// ------------------------------ File log sink ----------------------------- //
+
+FileLogSink::FileLogSink(const std::string &file_path) : file_(file_path) {
+  pending_.reserve(kMaxPendingBytes);
+  writing_.reserve(kMaxPendingBytes);
+  writer_ = std::thread(&FileLogSink::writeLoop, this);
+}
+
+FileLogSink::~FileLogSink() {
+  pubsync();
+  {
+    const std::lock_guard lock(mutex_);
+    stopping_ = true;
+  }
+  pending_condition_.notify_one();
+  writer_.join();
+}
+
+std::size_t FileLogSink::getDroppedBytes() {
+  const std::lock_guard lock(mutex_);
+  return dropped_bytes_;
+}
+
+void FileLogSink::consume(const std::string_view text) {
+  if (text.empty()) { return; }
+  {
+    const std::lock_guard lock(mutex_);
+    if (pending_.size() + text.size() > kMaxPendingBytes) {
+      dropped_bytes_ += text.size();
+      return;
+    }
+    pending_.append(text);
+  }
+  pending_condition_.notify_one();
+}
+
+void FileLogSink::writeLoop() {
+  while (true) {
+    {
+      std::unique_lock lock(mutex_);
+      pending_condition_.wait(lock, [this] {
+        return stopping_ || !pending_.empty();
+      });
+      if (pending_.empty()) { break; }
+      std::swap(pending_, writing_);
+    }
+    file_ << writing_;
+    file_.flush();
+    writing_.clear();
+  }
+}
+
+// ---------------------------- Progress log sink --------------------------- //
+
+ProgressLogSink::ProgressLogSink(const std::size_t capacity) :
+  capacity_ {capacity} {
+  records_.reserve(capacity_);
+  line_.reserve(kMaxLineLength);
+}
+
+std::vector<ProgressRecord> ProgressLogSink::getRecords() {
+  pubsync();
+  if (records_.size() < capacity_) { return records_; }
+  std::vector<ProgressRecord> records(
+    records_.begin() + (long)head_, records_.end()
+  );
+  records.insert(
+    records.end(), records_.begin(), records_.begin() + (long)head_
+  );
+  return records;
+}
+
+void ProgressLogSink::consume(const std::string_view text) {
+  for (const auto character : text) {
+    if (character == '\n') {
+      if (!skipping_line_) { parseLine(line_); }
+      line_.clear();
+      skipping_line_ = false;
+    } else if (line_.size() < kMaxLineLength) {
+      line_ += character;
+    } else {
+      skipping_line_ = true;
+    }
+  }
+}
+
+void ProgressLogSink::parseLine(const std::string_view line) {
+  auto words = splitWords(line);
+  // New incumbents are marked with '*' (or 'H' for heuristic solutions)
+  if (!words.empty() && (words.front() == "*" || words.front() == "H")) {
+    words.erase(words.begin());
+  }
+  ProgressRecord record {
+    .nodes = 0,
+    .nodes_left = 0,
+    .incumbent = std::numeric_limits<double>::quiet_NaN(),
+    .bound = std::numeric_limits<double>::quiet_NaN(),
+    .gap = std::numeric_limits<double>::quiet_NaN()
+  };
+  if (words.size() < 3 || !parseNodeCounter(words[0], record.nodes) ||
+      !parseNodeCounter(words[1], record.nodes_left)) {
+    return;
+  }
+  std::vector<double> values;
+  for (auto word : words | std::views::drop(2)) {
+    double value = 0;
+    if (word.ends_with('%')) {
+      word.remove_suffix(1);
+      if (parseValue(word, value)) { record.gap = value / 100; }
+    } else if (parseValue(word, value)) {
+      values.push_back(value);
+    }
+  }
+  if (values.empty()) { return; }
+  // The bound is the last value and, when there is a gap, it is preceded by
+  // the incumbent
+  record.bound = values.back();
+  if (!std::isnan(record.gap) && values.size() >= 2) {
+    record.incumbent = values[values.size() - 2];
+  }
+  if (capacity_ == 0) { return; }
+  if (records_.size() < capacity_) {
+    records_.push_back(record);
+  } else {
+    records_[head_] = record;
+  }
+  head_ = (head_ + 1) % capacity_;
+}
+
+// -------------------------------- Factory -------------------------------- //
+
+std::unique_ptr<LogSink>
+createLogSink(const LogMode mode, const std::string &file_path) {
+  switch (mode) {
+    case LogMode::kRing: return std::make_unique<RingLogSink>();
+    case LogMode::kFile: return std::make_unique<FileLogSink>(file_path);
+    case LogMode::kProgress: return std::make_unique<ProgressLogSink>();
+    case LogMode::kDiscard: break;
+  }
+  return std::make_unique<DiscardLogSink>();
+}
\ No newline at end of file
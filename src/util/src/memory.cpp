@@ -0,0 +1,256 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file memory.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the memory instrumentation and
+ * the replacement of the global operator new / delete that counts the bytes
+ * allocated by each category (only with OPS_ENABLE_MEMORY_PROFILING).
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <memory.hpp>
+
+namespace {
+
+/** @brief Counters of the bytes allocated by a category. */
+struct AllocationCounters {
+  // Bytes allocated and not released yet.
+  std::atomic<long long> live_bytes {0};
+  // Maximum amount of live bytes reached.
+  std::atomic<long long> peak_bytes {0};
+};
+
+// The counters of each category.
+std::array<AllocationCounters, kAllocationCategories> allocation_counters;
+
+// The category the current thread attributes its allocations to.
+thread_local AllocationCategory current_category = AllocationCategory::kOther;
+
+// Whether several instances are processed at once by the process.
+std::atomic<bool> is_concurrent {false};
+
+#ifdef OPS_ENABLE_MEMORY_PROFILING
+
+/**
+ * @brief Header stored in front of each counted allocation, so the delete
+ * knows how many bytes to release and from which category. Its size keeps the
+ * default alignment of operator new.
+ */
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) AllocationHeader {
+  // Bytes requested by the user.
+  std::size_t size;
+  // The category the allocation was attributed to.
+  AllocationCategory category;
+};
+
+/**
+ * @brief Allocates memory with a header and counts it.
+ *
+ * @param size The amount of bytes requested.
+ * @return The memory for the user, or nullptr if it could not be allocated.
+ */
+void *countedAllocate(const std::size_t size) noexcept {
+  auto *header =
+    static_cast<AllocationHeader *>(std::malloc(sizeof(AllocationHeader) + size)
+    );
+  if (header == nullptr) { return nullptr; }
+  header->size = size;
+  header->category = current_category;
+  auto &counters = allocation_counters[(std::size_t)current_category];
+  const auto live_bytes = counters.live_bytes += (long long)size;
+  auto peak_bytes = counters.peak_bytes.load(std::memory_order_relaxed);
+  while (live_bytes > peak_bytes &&
+         !counters.peak_bytes.compare_exchange_weak(peak_bytes, live_bytes)) {}
+  return header + 1;
+}
+
+/**
+ * @brief Releases memory allocated by countedAllocate.
+ *
+ * @param pointer The memory given to the user.
+ */
+void countedRelease(void *pointer) noexcept {
+  if (pointer == nullptr) { return; }
+  auto *header = static_cast<AllocationHeader *>(pointer) - 1;
+  allocation_counters[(std::size_t)header->category].live_bytes -=
+    (long long)header->size;
+  std::free(header);
+}
+
+/**
+ * @brief Allocates memory, calling the new handler until it succeeds.
+ *
+ * @param size The amount of bytes requested.
+ */
+void *countedAllocateOrThrow(const std::size_t size) {
+  while (true) {
+    if (void *pointer = countedAllocate(size)) { return pointer; }
+    const auto handler = std::get_new_handler();
+    if (handler == nullptr) { throw std::bad_alloc(); }
+    handler();
+  }
+}
+
+#endif  // OPS_ENABLE_MEMORY_PROFILING
+
+/**
+ * @brief Reads a field (in KiB) from the status of the process.
+ *
+ * @param field The name of the field, including the colon.
+ * @return The value of the field, -1 if it could not be read.
+ */
+long readProcessStatus(const std::string_view field) {
+  std::ifstream status_file("/proc/self/status");
+  std::string line;
+  while (std::getline(status_file, line)) {
+    if (line.starts_with(field)) {
+      return std::strtol(line.c_str() + field.size(), nullptr, 10);
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Resets the high-water mark of the resident set size (Linux), unless
+ * it is shared by several instances or the memory is not profiled.
+ */
+void resetPeakRss() {
+#ifdef OPS_ENABLE_MEMORY_PROFILING
+  if (is_concurrent) { return; }
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+#endif
+}
+
+}  // namespace
+
+// -------------------------- Allocation categories ------------------------- //
+
+std::string_view getCategoryName(const AllocationCategory category) {
+  switch (category) {
+    case AllocationCategory::kInput: return "input";
+    case AllocationCategory::kGraphs: return "graphs";
+    case AllocationCategory::kModel: return "model";
+    case AllocationCategory::kOutput: return "output";
+    case AllocationCategory::kOther: break;
+  }
+  return "other";
+}
+
+AllocationStats getAllocationStats(const AllocationCategory category) {
+  const auto &counters = allocation_counters[(std::size_t)category];
+  return {
+    .live_bytes = counters.live_bytes.load(),
+    .peak_bytes = counters.peak_bytes.load()
+  };
+}
+
+AllocationScope::AllocationScope(const AllocationCategory category) :
+  previous_category_ {current_category} {
+  current_category = category;
+}
+
+AllocationScope::~AllocationScope() {
+  current_category = previous_category_;
+}
+
+// ----------------------------- Memory profile ----------------------------- //
+
+MemoryProfile &MemoryProfile::current() {
+  thread_local MemoryProfile profile;
+  return profile;
+}
+
+void MemoryProfile::setConcurrent(const bool concurrent) {
+  is_concurrent = concurrent;
+}
+
+void MemoryProfile::clear() {
+  phases_.clear();
+  resetPeakRss();
+}
+
+void MemoryProfile::markPhase(const std::string_view phase) {
+  PhaseMemory phase_memory {
+    .phase = std::string(phase),
+    .peak_rss_kb = readProcessStatus("VmHWM:"),
+    .rss_kb = readProcessStatus("VmRSS:"),
+    .allocations = {}
+  };
+  for (std::size_t idx = 0; idx < kAllocationCategories; ++idx) {
+    phase_memory.allocations[idx] =
+      getAllocationStats(static_cast<AllocationCategory>(idx));
+  }
+  phases_.push_back(std::move(phase_memory));
+  resetPeakRss();
+}
+
+// ----------------------- Global operator new / delete --------------------- //
+
+#ifdef OPS_ENABLE_MEMORY_PROFILING
+
+// NOLINTBEGIN(misc-new-delete-overloads)
+void *operator new(const std::size_t size) {
+  return countedAllocateOrThrow(size);
+}
+
+void *operator new[](const std::size_t size) {
+  return countedAllocateOrThrow(size);
+}
+
+void *operator new(const std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAllocate(size);
+}
+
+void *operator new[](const std::size_t size, const std::nothrow_t &) noexcept {
+  return countedAllocate(size);
+}
+
+void operator delete(void *pointer) noexcept {
+  countedRelease(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+  countedRelease(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  countedRelease(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+  countedRelease(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  countedRelease(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  countedRelease(pointer);
+}
+// NOLINTEND(misc-new-delete-overloads)
+#endif  // OPS_ENABLE_MEMORY_PROFILING
\ No newline at end of file
@@ -0,0 +1,164 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file result_cache.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the on-disk cache of results.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <algorithm>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <result_cache.hpp>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/** @brief Holds an exclusive lock over a file while it is alive. */
+class FileLock {
+ public:
+  /**
+   * @brief Opens the file (creating it if needed) and waits for the lock.
+   *
+   * @param path The path to the file to lock.
+   */
+  explicit FileLock(const fs::path &path) :
+    descriptor_ {::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)} {
+    if (descriptor_ >= 0) { ::flock(descriptor_, LOCK_EX); }
+  }
+
+  /** @brief Releases the lock. */
+  ~FileLock() {
+    if (descriptor_ >= 0) { ::close(descriptor_); }
+  }
+
+  FileLock(const FileLock &) = delete;
+  FileLock(FileLock &&) = delete;
+  FileLock &operator=(const FileLock &) = delete;
+  FileLock &operator=(FileLock &&) = delete;
+
+ private:
+  // The descriptor of the locked file, negative if it could not be opened.
+  int descriptor_;
+};
+
+/** @brief Gets a file name suffix no other writer is using at the moment. */
+std::string getUniqueSuffix() {
+  static std::atomic<unsigned> counter {0};
+  return std::format(
+    ".{}.{}.{}.tmp", ::getpid(),
+    std::hash<std::thread::id> {}(std::this_thread::get_id()), ++counter
+  );
+}
+
+}  // namespace
+
+ResultCache::ResultCache(fs::path directory, const ResultCacheLimits limits) :
+  directory_ {std::move(directory)}, limits_ {limits} {
+  fs::create_directories(directory_);
+}
+
+std::optional<std::string> ResultCache::load(const std::string_view key
+) const {
+  const auto entry_path = getEntryPath(key);
+  std::error_code error;
+  const auto last_write_time = fs::last_write_time(entry_path, error);
+  if (error ||
+      fs::file_time_type::clock::now() - last_write_time > limits_.max_age) {
+    return std::nullopt;
+  }
+  std::ifstream entry_file(entry_path);
+  if (!entry_file) { return std::nullopt; }
+  std::stringstream result;
+  result << entry_file.rdbuf();
+  // Mark the entry as recently used for the eviction
+  fs::last_write_time(entry_path, fs::file_time_type::clock::now(), error);
+  return result.str();
+}
+
+void ResultCache::store(
+  const std::string_view key, const std::string_view result
+) const {
+  const auto entry_path = getEntryPath(key);
+  auto temporary_path = entry_path;
+  temporary_path += getUniqueSuffix();
+  {
+    std::ofstream temporary_file(temporary_path);
+    temporary_file << result;
+    if (!temporary_file.flush()) {
+      std::error_code error;
+      fs::remove(temporary_path, error);
+      return;
+    }
+  }
+  // The rename is atomic, so readers see either the old entry or the new one
+  std::error_code error;
+  fs::rename(temporary_path, entry_path, error);
+  if (error) { fs::remove(temporary_path, error); }
+  evict();
+}
+
+void ResultCache::evict() const {
+  const FileLock lock(directory_ / kLockFileName);
+  const auto now = fs::file_time_type::clock::now();
+  std::vector<std::pair<fs::file_time_type, fs::directory_entry>> entries;
+  std::uintmax_t total_bytes = 0;
+  std::error_code error;
+  for (const auto &entry : fs::directory_iterator(directory_, error)) {
+    if (entry.path().extension() != kEntryExtension) { continue; }
+    const auto last_write_time = entry.last_write_time(error);
+    if (error) { continue; }
+    if (now - last_write_time > limits_.max_age) {
+      fs::remove(entry.path(), error);
+      continue;
+    }
+    total_bytes += entry.file_size(error);
+    entries.emplace_back(last_write_time, entry);
+  }
+  std::ranges::sort(entries, {}, &decltype(entries)::value_type::first);
+  for (const auto &[last_write_time, entry] : entries) {
+    if (total_bytes <= limits_.max_bytes) { break; }
+    const auto entry_size = entry.file_size(error);
+    if (fs::remove(entry.path(), error)) { total_bytes -= entry_size; }
+  }
+}
+
+// ---------------------------- Private Methods ---------------------------- //
+
+fs::path ResultCache::getEntryPath(const std::string_view key) const {
+  return directory_ / (std::string(key) + std::string(kEntryExtension));
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+// clang-format off
+/**
+ * University: Universidad de La Laguna
+ * Center: Escuela Superior de Ingeniería y Tecnología
+ * Grade: Ingeniería Informática
+ * Subject: T.F.G.
+ * Course: Fifth
+ * Institutional email: gian.diana.28@ull.edu.es
+ *
+ * @file trace.cpp
+ * @author Gian Luis Bolivar Diana
+ * @version 1.0.0
+ * @date October 19, 2026
+ * @copyright Copyright (c) 2026
+ *
+ * @brief File containing the implementation of the recorder of Chrome trace
+ * events.
+ *
+ * @see GitHub repository: @link https://github.com/gianluisdiana/OpsCplex @endlink
+ * @see Google style guide: @link https://google.github.io/styleguide/cppguide.html @endlink
+ */
+// clang-format on
+
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <trace.hpp>
+
+namespace {
+
+// Identifier of the process in the trace.
+constexpr int kProcessId = 1;
+
+/** @brief Gets a small identifier for the current thread. */
+int getThreadId() {
+  static std::atomic<int> thread_counter {0};
+  thread_local const int thread_id = ++thread_counter;
+  return thread_id;
+}
+
+/**
+ * @brief Escapes a text to be written inside a JSON string.
+ *
+ * @param text The text to escape.
+ */
+std::string escape(const std::string_view text) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (const auto character : text) {
+    if (character == '"' || character == '\\') { escaped += '\\'; }
+    escaped += character;
+  }
+  return escaped;
+}
+
+}  // namespace
+
+// ----------------------------- Trace recorder ----------------------------- //
+
+TraceRecorder &TraceRecorder::instance() {
+  static TraceRecorder recorder;
+  return recorder;
+}
+
+void TraceRecorder::enable(std::string output_path) {
+  output_path_ = std::move(output_path);
+}
+
+long long TraceRecorder::now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - start_
+  )
+    .count();
+}
+
+void TraceRecorder::addSpan(
+  const std::string_view name, const long long start, const long long duration
+) {
+  addEvent(std::format(
+    R"({{"name":"{}","cat":"ops","ph":"X","ts":{},"dur":{},"pid":{},"tid":{}}})",
+    escape(name), start, duration, kProcessId, getThreadId()
+  ));
+}
+
+void TraceRecorder::addCounter(
+  const std::string_view name,
+  const std::initializer_list<std::pair<std::string_view, double>> values
+) {
+  std::string args;
+  for (const auto &[series, value] : values) {
+    if (!args.empty()) { args += ','; }
+    args += std::format(R"("{}":{})", escape(series), value);
+  }
+  addEvent(std::format(
+    R"({{"name":"{}","ph":"C","ts":{},"pid":{},"args":{{{}}}}})", escape(name),
+    now(), kProcessId, args
+  ));
+}
+
+void TraceRecorder::setThreadName(const std::string_view name) {
+  addEvent(std::format(
+    R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"{}"}}}})",
+    kProcessId, getThreadId(), escape(name)
+  ));
+}
+
+void TraceRecorder::flush() {
+  if (!isEnabled()) { return; }
+  const std::lock_guard lock(mutex_);
+  std::ofstream trace_file(output_path_);
+  trace_file << "{\"traceEvents\":[\n";
+  for (std::size_t idx = 0; idx < events_.size(); ++idx) {
+    trace_file << events_[idx] << (idx + 1 < events_.size() ? ",\n" : "\n");
+  }
+  trace_file << "]}\n";
+}
+
+void TraceRecorder::addEvent(std::string event) {
+  if (!isEnabled()) { return; }
+  const std::lock_guard lock(mutex_);
+  events_.push_back(std::move(event));
+}
+
+// ------------------------------- Trace span ------------------------------- //
+
+TraceSpan::TraceSpan(std::string name) :
+  name_ {std::move(name)}, start_ {TraceRecorder::instance().now()} {}
+
+TraceSpan::~TraceSpan() {
+  auto &recorder = TraceRecorder::instance();
+  recorder.addSpan(name_, start_, recorder.now() - start_);
+}
\ No newline at end of file
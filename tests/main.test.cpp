@@ -1,14 +1,25 @@
+#include <array>
+#include <cmath>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include <checkpoint.hpp>
+#include <difficulty_estimator.hpp>
 #include <functions.hpp>
+#include <instance_generator.hpp>
+#include <log_sink.hpp>
+#include <ops_cp_solver.hpp>
 #include <ops_cplex_solver.hpp>
+#include <rolling_horizon_solver.hpp>
+#include <triage.hpp>
 
 namespace fs = std::filesystem;
 
@@ -25,7 +36,7 @@ void testModelClass(const std::string &model_class) {
   const auto solution_folder = std::format("data/{}/outputs/", model_class);
   const double tolerance = 1e-4;
   nlohmann::json solution;
-  std::stringstream string_stream;
+  DiscardLogSink log_sink;
   for (const auto &entry : fs::directory_iterator(input_folder)) {
     std::ifstream solution_file(
       solution_folder + entry.path().filename().string()
@@ -33,14 +44,89 @@ void testModelClass(const std::string &model_class) {
     emir::OpsCplexSolver solver(
       createFromFile<emir::OpsInput>(entry.path()), tolerance
     );
-    solver.addLog(string_stream);
+    solver.addLog(log_sink.getStream());
     ASSERT_NO_THROW(solver.solve());
     solution_file >> solution;
     EXPECT_EQ(solver.getProfit(), solution["profit"].get<double>());
-    string_stream.str(std::string());
   }
 }
 
+/**
+ * @brief Generates a synthetic instance and reads it as an input.
+ *
+ * @param generator_config The parameters of the instance.
+ * @return The input of the generated instance.
+ */
+emir::OpsInput generateInput(const emir::GeneratorConfig &generator_config) {
+  emir::InstanceGenerator generator(generator_config);
+  std::stringstream instance_stream;
+  instance_stream << generator.generate();
+  emir::OpsInput input;
+  instance_stream >> input;
+  return input;
+}
+
+/**
+ * @brief Builds an input whose first two sliding bars are equal and lie,
+ * like the fourth one, inside the third.
+ *
+ * @return The input with the nested sliding bars.
+ */
+emir::OpsInput makeNestedInput() {
+  return emir::OpsInput(emir::OpsInstance(nlohmann::json {
+    {"id", {"nested", "2026-10-19 00:00:00"}},
+    {"type", 0},
+    {"alpha", 0.5},
+    {"L", 100},
+    {"b", {0, 1, 1, 1, 0}},
+    {"Jk", {{1, 2}, {2, 1}, {1, 2, 3}, {3}}},
+    {"T",
+     {{0, 1, 1, 1, 1},
+      {1, 0, 1, 1, 1},
+      {1, 1, 0, 1, 1},
+      {1, 1, 1, 0, 1},
+      {1, 1, 1, 1, 0}}},
+  }));
+}
+
+/**
+ * @brief Ensures that two configurations of the solver reach the same optimum
+ * on the given input.
+ *
+ * @param config_a The configuration of the first solver.
+ * @param config_b The configuration of the second solver.
+ * @param input The input to solve.
+ */
+void expectSameOptimum(
+  const emir::SolverConfig &config_a, const emir::SolverConfig &config_b,
+  const emir::OpsInput &input
+) {
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver solver_a(emir::OpsInput(input), config_a);
+  solver_a.addLog(log_sink.getStream());
+  solver_a.solve();
+  emir::OpsCplexSolver solver_b(emir::OpsInput(input), config_b);
+  solver_b.addLog(log_sink.getStream());
+  solver_b.solve();
+  EXPECT_NEAR(solver_b.getProfit(), solver_a.getProfit(), 1e-4);
+}
+
+/**
+ * @brief Ensures that two configurations of the solver reach the same optimum
+ * on a generated instance.
+ *
+ * @param config_a The configuration of the first solver.
+ * @param config_b The configuration of the second solver.
+ * @param generator_config The parameters of the instance.
+ */
+void expectSameOptimum(
+  const emir::SolverConfig &config_a, const emir::SolverConfig &config_b,
+  const emir::GeneratorConfig &generator_config =
+    {.amount_of_objects = 10, .amount_of_sliding_bars = 3, .bar_overlap = 0.4}
+) {
+  expectSameOptimum(config_a, config_b, generateInput(generator_config));
+}
+
 TEST(OpsTest_FamilyH, OneBandNeeded) {
   testModelClass("A");
 }
@@ -65,6 +151,256 @@ TEST(OpsTest_FamilyE, ThreeBandsNeeded) {
   testModelClass("LC");
 }
 
+TEST(OpsTest_Generator, SameSeedSameInstance) {
+  const emir::GeneratorConfig config {
+    .amount_of_objects = 30, .amount_of_sliding_bars = 4, .bar_overlap = 0.3
+  };
+  const auto first_instance = emir::InstanceGenerator(config).generate();
+  const auto second_instance = emir::InstanceGenerator(config).generate();
+  EXPECT_EQ(first_instance, second_instance);
+}
+
+TEST(OpsTest_Generator, GeneratedInstanceIsSolvable) {
+  const auto input = generateInput({
+    .amount_of_objects = 8,
+    .amount_of_sliding_bars = 2,
+    .bar_overlap = 0.3,
+    .metric = false,
+  });
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver solver(input, 1e-4);
+  solver.addLog(log_sink.getStream());
+  ASSERT_NO_THROW(solver.solve());
+  EXPECT_GE(solver.getProfit(), 0);
+}
+
+TEST(OpsTest_Solver, UpdatedPrioritiesMatchFreshSolve) {
+  auto input = generateInput({
+    .amount_of_objects = 8,
+    .amount_of_sliding_bars = 2,
+    .bar_overlap = 0.3,
+  });
+  std::vector<int> priorities;
+  for (std::size_t idx = 0; idx < input.getAmountOfObjects(); ++idx) {
+    priorities.push_back(input.getPriority(idx) % 3 + 1);
+  }
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver warm_solver(input, 1e-4);
+  warm_solver.addLog(log_sink.getStream());
+  warm_solver.solve();
+  warm_solver.updatePriorities(priorities);
+  warm_solver.solve();
+  input.setPriorities(priorities);
+  emir::OpsCplexSolver fresh_solver(input, 1e-4);
+  fresh_solver.addLog(log_sink.getStream());
+  fresh_solver.solve();
+  EXPECT_NEAR(warm_solver.getProfit(), fresh_solver.getProfit(), 1e-4);
+}
+
+TEST(OpsTest_Input, DetectsNestedSlidingBars) {
+  const auto input = makeNestedInput();
+  const auto nested_sliding_bars = input.getNestedSlidingBars();
+  ASSERT_EQ(nested_sliding_bars.size(), 3);
+  EXPECT_EQ(nested_sliding_bars[0].inner_idx, 1);
+  EXPECT_EQ(nested_sliding_bars[0].outer_idx, 0);
+  EXPECT_TRUE(nested_sliding_bars[0].are_equal);
+  EXPECT_EQ(nested_sliding_bars[1].inner_idx, 0);
+  EXPECT_EQ(nested_sliding_bars[1].outer_idx, 2);
+  EXPECT_FALSE(nested_sliding_bars[1].are_equal);
+  EXPECT_EQ(nested_sliding_bars[2].inner_idx, 3);
+  EXPECT_EQ(nested_sliding_bars[2].outer_idx, 2);
+}
+
+TEST(OpsTest_Solver, SymmetryBreakingKeepsTheOptimum) {
+  expectSameOptimum({.symmetry_breaking = false}, {}, makeNestedInput());
+}
+
+TEST(OpsTest_Solver, RemovedAndAddedObjectKeepsProfit) {
+  const auto input = generateInput({
+    .amount_of_objects = 8,
+    .amount_of_sliding_bars = 2,
+    .bar_overlap = 0.3,
+  });
+  const auto object_id = input.getObjectsPerSlidingBar(0).front();
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver solver(input, 1e-4);
+  solver.addLog(log_sink.getStream());
+  solver.solve();
+  const auto profit = solver.getProfit();
+  solver.removeObjectFromSlidingBar(0, object_id);
+  solver.solve();
+  EXPECT_LE(solver.getProfit(), profit + 1e-4);
+  solver.addObjectToSlidingBar(0, object_id);
+  solver.solve();
+  EXPECT_NEAR(solver.getProfit(), profit, 1e-4);
+}
+
+TEST(OpsTest_Solver, UserCutsKeepTheOptimum) {
+  expectSameOptimum({}, {.user_cuts = true});
+}
+
+TEST(OpsTest_Solver, TimeFlowFormulationKeepsTheOptimum) {
+  expectSameOptimum({}, {.formulation = emir::Formulation::kTimeFlow});
+}
+
+TEST(OpsTest_Solver, TimeIndexedFormulationKeepsTheOptimum) {
+  // Buckets longer than one unit, so the times of the arcs are rounded down
+  expectSameOptimum(
+    {}, {.formulation = emir::Formulation::kTimeIndexed, .time_bucket = 7}
+  );
+}
+
+TEST(OpsTest_Solver, ReducedCostFixingKeepsTheOptimum) {
+  expectSameOptimum({}, {.reduced_cost_fixing = true});
+}
+
+TEST(OpsTest_Solver, AggregateBranchingKeepsTheOptimum) {
+  expectSameOptimum({}, {.branching = emir::Branching::kAggregates});
+}
+
+TEST(OpsTest_Solver, RoundingHeuristicKeepsTheOptimum) {
+  expectSameOptimum({}, {.heuristic_frequency = 1});
+}
+
+TEST(OpsTest_Solver, CachedModelKeepsTheOptimum) {
+  const auto input = generateInput({
+    .amount_of_objects = 8,
+    .amount_of_sliding_bars = 2,
+    .bar_overlap = 0.3,
+  });
+  const auto model_cache = fs::temp_directory_path() / "ops_model_cache";
+  fs::remove_all(model_cache);
+  const emir::SolverConfig config {.model_cache = model_cache.string()};
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver built_solver(emir::OpsInput(input), config);
+  built_solver.addLog(log_sink.getStream());
+  built_solver.solve();
+  // The second solver loads the model saved by the first one
+  ASSERT_EQ(std::distance(fs::directory_iterator(model_cache), {}), 1);
+  emir::OpsCplexSolver loaded_solver(emir::OpsInput(input), config);
+  loaded_solver.addLog(log_sink.getStream());
+  loaded_solver.solve();
+  fs::remove_all(model_cache);
+  EXPECT_NEAR(loaded_solver.getProfit(), built_solver.getProfit(), 1e-4);
+  EXPECT_EQ(
+    loaded_solver.getSolutionValues().size(),
+    built_solver.getSolutionValues().size()
+  );
+}
+
+TEST(OpsTest_Solver, CpOptimizerPlanIsBoundedByCplex) {
+  const auto input = generateInput({
+    .amount_of_objects = 10,
+    .amount_of_sliding_bars = 3,
+    .bar_overlap = 0.4,
+  });
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver cplex_solver(input, 1e-4);
+  cplex_solver.addLog(log_sink.getStream());
+  cplex_solver.solve();
+  emir::OpsCpSolver cp_solver(emir::OpsInput(input), {.time_limit = 10});
+  cp_solver.addLog(log_sink.getStream());
+  // The plan is checked against the constraints of the output
+  cp_solver.solve();
+  EXPECT_GE(cp_solver.getOutput().getTimeSpent(), 0);
+  EXPECT_LE(cp_solver.getProfit(), cplex_solver.getProfit() + 1e-4);
+}
+
+TEST(OpsTest_Solver, RollingHorizonIsBoundedByFullSolve) {
+  const auto input = generateInput({
+    .amount_of_objects = 10,
+    .amount_of_sliding_bars = 2,
+    .bar_overlap = 0.3,
+  });
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver full_solver(input, 1e-4);
+  full_solver.addLog(log_sink.getStream());
+  full_solver.solve();
+  emir::RollingHorizonSolver rolling_horizon_solver(
+    emir::OpsInput(input), {.time_limit = 60}, {.windows = 3}
+  );
+  rolling_horizon_solver.addLog(log_sink.getStream());
+  rolling_horizon_solver.solve();
+  const auto &output = rolling_horizon_solver.getOutput();
+  EXPECT_GE(output.getTimeSpent(), 0);
+  EXPECT_LE(output.getTotalProfit(), full_solver.getProfit() + 1e-4);
+}
+
+TEST(OpsTest_Triage, KnapsackBoundIsAboveTheOptimum) {
+  const auto input = generateInput(
+    {.amount_of_objects = 10, .amount_of_sliding_bars = 3, .bar_overlap = 0.4}
+  );
+  DiscardLogSink log_sink;
+  emir::OpsCplexSolver solver(input, 1e-4);
+  solver.addLog(log_sink.getStream());
+  solver.solve();
+  EXPECT_GE(getKnapsackBound(input), solver.getProfit() - 1e-4);
+}
+
+TEST(OpsTest_DifficultyEstimator, FitRecoversKnownCoefficients) {
+  const std::array<double, 6> coefficients {1.5, 0.8, 0.4, 1.2, -0.6, 0.3};
+  std::vector<DifficultyEstimator::Features> samples;
+  std::vector<double> times;
+  for (int idx = 0; idx < 64; ++idx) {
+    const DifficultyEstimator::Features features {
+      .objects = 10.0 * (1 + idx % 4),
+      .sliding_bars = 1.0 + (idx / 4) % 4,
+      .overlap = 0.1 * (idx % 3),
+      .tightness = 0.5 + 0.25 * ((idx / 16) % 4),
+      .arcs = 100.0 * (1 + idx % 5)
+    };
+    const double log_time =
+      coefficients[0] + coefficients[1] * std::log1p(features.objects) +
+      coefficients[2] * std::log1p(features.sliding_bars) +
+      coefficients[3] * features.overlap +
+      coefficients[4] * std::log(features.tightness) +
+      coefficients[5] * std::log1p(features.arcs);
+    samples.push_back(features);
+    times.push_back(std::expm1(log_time));
+  }
+  DifficultyEstimator estimator;
+  ASSERT_EQ(estimator.fit(samples, times), samples.size());
+  for (std::size_t idx = 0; idx < coefficients.size(); ++idx) {
+    EXPECT_NEAR(estimator.getCoefficients()[idx], coefficients[idx], 1e-3);
+  }
+  EXPECT_NEAR(estimator.predict(samples[5]), times[5], 1e-3 * times[5]);
+}
+
+TEST(OpsTest_LogSink, ParsesNodeLog) {
+  ProgressLogSink log_sink;
+  log_sink.getStream()
+    << "   Node  Left     Objective  IInf  Best Integer    Best Bound\n"
+    << "      0     0     1234.0000    12                   1234.0000     45\n"
+    << "*     0+    0                         1000.0000  1234.0000  23.40%\n"
+    << "Elapsed time = 0.01 sec. (tree size = 0.01 MB, solutions = 1)\n";
+  const auto records = log_sink.getRecords();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_TRUE(std::isnan(records[0].incumbent));
+  EXPECT_EQ(records[0].bound, 1234);
+  EXPECT_EQ(records[1].incumbent, 1000);
+  EXPECT_NEAR(records[1].gap, 0.234, 1e-9);
+}
+
+TEST(OpsTest_Checkpoint, RoundTrip) {
+  const emir::Checkpoint checkpoint {
+    .instance_hash = 0xcbf29ce484222325,
+    .elapsed_time = 1500,
+    .incumbent = std::nan(""),
+    .bound = 42.5,
+    .values = {0, 1, 0.5}
+  };
+  const auto file_path =
+    (fs::temp_directory_path() / "ops_checkpoint.json").string();
+  emir::writeCheckpoint(checkpoint, file_path);
+  const auto read_checkpoint = emir::readCheckpoint(file_path);
+  fs::remove(file_path);
+  EXPECT_EQ(read_checkpoint.instance_hash, checkpoint.instance_hash);
+  EXPECT_EQ(read_checkpoint.elapsed_time, checkpoint.elapsed_time);
+  EXPECT_TRUE(std::isnan(read_checkpoint.incumbent));
+  EXPECT_EQ(read_checkpoint.bound, checkpoint.bound);
+  EXPECT_EQ(read_checkpoint.values, checkpoint.values);
+}
+
 int main(int argc, char *argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();